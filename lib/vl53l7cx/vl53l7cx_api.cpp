@@ -489,6 +489,7 @@ uint8_t VL53L7CX::vl53l7cx_start_ranging()
   uint8_t cmd[] = {0x00, 0x03, 0x00, 0x00};
 
   status |= vl53l7cx_get_resolution(&resolution);
+  p_dev->zone_count = resolution;
   p_dev->data_read_size = 0;
   p_dev->streamcount = 255;
 
@@ -544,6 +545,9 @@ uint8_t VL53L7CX::vl53l7cx_start_ranging()
   output_bh_enable[0] += (uint32_t)2048;
 #endif
 
+  /* Apply the runtime output profile on top of the build-time one */
+  output_bh_enable[0] &= (uint32_t)0x7U | p_dev->output_enables;
+
   /* Update data size */
   for (i = 0; i < (uint32_t)(sizeof(output) / sizeof(uint32_t)); i++) {
     if ((output[i] == (uint8_t)0)
@@ -836,6 +840,98 @@ uint8_t VL53L7CX::vl53l7cx_get_ranging_data(VL53L7CX_ResultsData *p_results)
   return status;
 }
 
+uint8_t VL53L7CX::vl53l7cx_get_ranging_frame(VL53L7CX_RangingFrame *p_frame)
+{
+  uint8_t status = VL53L7CX_STATUS_OK;
+  uint16_t header_id, footer_id;
+  union Block_header *bh_ptr;
+  uint32_t i, msize, zone;
+  uint8_t has_nb_target = 0;
+  const uint32_t zones = (p_dev->zone_count == (uint8_t)0
+                          || p_dev->zone_count > VL53L7CX_RESOLUTION_8X8)
+                         ? (uint32_t)VL53L7CX_RESOLUTION_8X8
+                         : (uint32_t)p_dev->zone_count;
+
+  status |= RdMulti(&(p_dev->platform), 0x0,
+                    p_dev->temp_buffer, p_dev->data_read_size);
+  p_dev->streamcount = p_dev->temp_buffer[0];
+  SwapBuffer(p_dev->temp_buffer, (uint16_t)p_dev->data_read_size);
+  p_frame->zone_count = (uint8_t)zones;
+
+  /* Start conversion at position 16 to avoid headers, copy only the blocks the
+   * frame holds (first target of each zone) */
+  for (i = 16U; i < (uint32_t)p_dev->data_read_size; i += 4U) {
+    bh_ptr = (union Block_header *) & (p_dev->temp_buffer[i]);
+    if ((bh_ptr->type > 0x1U)
+        && (bh_ptr->type < 0xdU)) {
+      msize = bh_ptr->type * bh_ptr->size;
+    } else {
+      msize = bh_ptr->size;
+    }
+
+    switch (bh_ptr->idx) {
+#ifndef VL53L7CX_DISABLE_NB_TARGET_DETECTED
+      case VL53L7CX_NB_TARGET_DETECTED_IDX:
+        (void)memcpy(p_frame->nb_target_detected,
+                     &(p_dev->temp_buffer[i + (uint32_t)4]), zones);
+        has_nb_target = 1;
+        break;
+#endif
+#ifndef VL53L7CX_DISABLE_DISTANCE_MM
+      case VL53L7CX_DISTANCE_IDX:
+        for (zone = 0; zone < zones; zone++) {
+          (void)memcpy(&p_frame->distance_mm[zone],
+                       &(p_dev->temp_buffer[i + (uint32_t)4
+                                            + (zone * (uint32_t)VL53L7CX_NB_TARGET_PER_ZONE
+                                               * (uint32_t)sizeof(int16_t))]),
+                       sizeof(int16_t));
+        }
+        break;
+#endif
+#ifndef VL53L7CX_DISABLE_TARGET_STATUS
+      case VL53L7CX_TARGET_STATUS_IDX:
+        for (zone = 0; zone < zones; zone++) {
+          p_frame->target_status[zone] = p_dev->temp_buffer[i + (uint32_t)4
+                                                            + (zone * (uint32_t)VL53L7CX_NB_TARGET_PER_ZONE)];
+        }
+        break;
+#endif
+      default:
+        break;
+    }
+    i += msize;
+  }
+
+#ifndef VL53L7CX_USE_RAW_FORMAT
+  /* Convert data into their real format, for the active zones only */
+  for (zone = 0; zone < zones; zone++) {
+    p_frame->distance_mm[zone] /= 4;
+    if (p_frame->distance_mm[zone] < 0) {
+      p_frame->distance_mm[zone] = 0;
+    }
+    if ((has_nb_target != (uint8_t)0)
+        && (p_frame->nb_target_detected[zone] == (uint8_t)0)) {
+      p_frame->target_status[zone] = (uint8_t)255;
+    }
+  }
+#endif
+
+  /* Check if footer id and header id are matching. This allows to detect
+   * corrupted frames */
+  header_id = ((uint16_t)(p_dev->temp_buffer[0x8]) << 8) & 0xFF00U;
+  header_id |= ((uint16_t)(p_dev->temp_buffer[0x9])) & 0x00FFU;
+
+  footer_id = ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
+                                             - (uint32_t)4]) << 8) & 0xFF00U;
+  footer_id |= ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
+                                              - (uint32_t)3])) & 0xFFU;
+  if (header_id != footer_id) {
+    status |= VL53L7CX_STATUS_CORRUPTED_FRAME;
+  }
+
+  return status;
+}
+
 uint8_t VL53L7CX::vl53l7cx_get_resolution(uint8_t *p_resolution)
 {
   uint8_t status = VL53L7CX_STATUS_OK;
@@ -300,6 +300,10 @@ typedef struct {
   uint8_t           xtalk_data[VL53L7CX_XTALK_BUFFER_SIZE];
   /* Temporary buffer used for internal driver processing */
   uint8_t          temp_buffer[VL53L7CX_TEMPORARY_BUFFER_SIZE];
+  /* Runtime output profile (VL53L7CX_OUTPUT_* bits), applied at next start */
+  uint32_t          output_enables;
+  /* Number of zones of the current ranging session (16 or 64) */
+  uint8_t           zone_count;
 } VL53L7CX_Configuration;
 
 
@@ -378,6 +382,46 @@ typedef struct {
 
 } VL53L7CX_ResultsData;
 
+/**
+ * @brief Output blocks that can be switched off at runtime with
+ * vl53l7cx_set_output_enables(). A block disabled at build time (see the
+ * VL53L7CX_DISABLE_* macros) stays disabled whatever the mask says.
+ */
+
+#define VL53L7CX_OUTPUT_AMBIENT_PER_SPAD    ((uint32_t)8U)
+#define VL53L7CX_OUTPUT_NB_SPADS_ENABLED    ((uint32_t)16U)
+#define VL53L7CX_OUTPUT_NB_TARGET_DETECTED  ((uint32_t)32U)
+#define VL53L7CX_OUTPUT_SIGNAL_PER_SPAD     ((uint32_t)64U)
+#define VL53L7CX_OUTPUT_RANGE_SIGMA_MM      ((uint32_t)128U)
+#define VL53L7CX_OUTPUT_DISTANCE_MM         ((uint32_t)256U)
+#define VL53L7CX_OUTPUT_REFLECTANCE_PERCENT ((uint32_t)512U)
+#define VL53L7CX_OUTPUT_TARGET_STATUS       ((uint32_t)1024U)
+#define VL53L7CX_OUTPUT_MOTION_INDICATOR    ((uint32_t)2048U)
+#define VL53L7CX_OUTPUT_ALL                 ((uint32_t)0xFF8U)
+
+/**
+ * @brief Structure VL53L7CX_RangingFrame is a slim alternative to
+ * VL53L7CX_ResultsData, filled by vl53l7cx_get_ranging_frame(). It only holds
+ * the first target of each zone, and only the distance, target count and
+ * status blocks. Only the first zone_count entries are valid, and blocks the
+ * output profile doesn't stream are left as the caller initialised them.
+ */
+
+typedef struct {
+  /* Number of valid zones (16 for 4x4, 64 for 8x8) */
+  uint8_t zone_count;
+
+  /* Number of valid target detected for 1 zone */
+  uint8_t nb_target_detected[VL53L7CX_RESOLUTION_8X8];
+
+  /* Measured distance in mm (first target) */
+  int16_t distance_mm[VL53L7CX_RESOLUTION_8X8];
+
+  /* Status indicating the measurement validity (5 & 9 means ranging OK)*/
+  uint8_t target_status[VL53L7CX_RESOLUTION_8X8];
+
+} VL53L7CX_RangingFrame;
+
 #ifndef BLOCK_HEADER
 #define BLOCK_HEADER
 union Block_header {
@@ -67,12 +67,14 @@ class VL53L7CX {
       _dev.platform.dev_i2c = i2c;
       _dev.platform.lpn_pin = lpn_pin;
       _dev.platform.i2c_rst_pin = i2c_rst_pin;
+      _dev.platform.i2c_port = -1;
       
       // Initialize non-blocking timing state
       _dev.platform.wait_start_time = 0;
       _dev.platform.wait_duration = 0;
       _dev.platform.wait_active = false;
       _dev.platform.initialization_mode = true; // Start in blocking mode for init
+      _dev.output_enables = VL53L7CX_OUTPUT_ALL;
       
       p_dev = &_dev;
     }
@@ -249,6 +251,16 @@ class VL53L7CX {
 
     uint8_t vl53l7cx_start_ranging();
     
+    /**
+     * @brief Lets large writes (firmware upload, configuration buffers) bypass
+     * the TwoWire buffer and go to the ESP-IDF I2C driver of the same bus in
+     * VL53L7CX_LARGE_WRITE_CHUNK transactions. Only meaningful on ESP32.
+     * @param (int) i2c_port : ESP-IDF port number of the TwoWire instance, or -1.
+     */
+    void vl53l7cx_set_i2c_port(int i2c_port) {
+      _dev.platform.i2c_port = i2c_port;
+    }
+
     /**
      * @brief Enable non-blocking mode after initialization
      */
@@ -285,6 +297,30 @@ class VL53L7CX {
     uint8_t vl53l7cx_get_ranging_data(
       VL53L7CX_ResultsData    *p_results);
 
+    /**
+     * @brief This function selects which output blocks the sensor streams. Fewer
+     * blocks means a smaller I2C transfer for every frame. It takes effect at the
+     * next vl53l7cx_start_ranging().
+     * @param (uint32_t) output_enables : VL53L7CX_OUTPUT_* bits to keep enabled.
+     */
+
+    void vl53l7cx_set_output_enables(
+      uint32_t       output_enables)
+    {
+      _dev.output_enables = output_enables;
+    }
+
+    /**
+     * @brief This function gets the ranging data into the slim frame structure,
+     * parsing only the distance, target count and target status blocks, and only
+     * the zones of the current resolution.
+     * @param (VL53L7CX_RangingFrame) *p_frame : VL53L7 slim frame structure.
+     * @return (uint8_t) status : 0 data are successfully get.
+     */
+
+    uint8_t vl53l7cx_get_ranging_frame(
+      VL53L7CX_RangingFrame   *p_frame);
+
     /**
      * @brief This function gets the current resolution (4x4 or 8x8).
      * @param (uint8_t) *p_resolution : Value of this pointer will be equal to 16
@@ -38,6 +38,10 @@
 
 #include "vl53l7cx_class.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+  #include <driver/i2c.h>
+#endif
+
 uint8_t VL53L7CX::RdByte(
   VL53L7CX_Platform *p_platform,
   uint16_t RegisterAddress,
@@ -66,6 +70,36 @@ uint8_t VL53L7CX::WrMulti(
   uint32_t i = 0;
   uint8_t buffer[2];
 
+#ifdef ARDUINO_ARCH_ESP32
+  // Large writes go straight to the IDF driver that TwoWire itself sits on, one
+  // VL53L7CX_LARGE_WRITE_CHUNK transaction at a time instead of one per
+  // DEFAULT_I2C_BUFFER_LEN bytes. The driver serialises commands per port, so
+  // this interleaves safely with other TwoWire users of the bus.
+  if (p_platform->i2c_port >= 0 && size > DEFAULT_I2C_BUFFER_LEN) {
+    while (i < size) {
+      uint32_t current_write_size = (size - i > VL53L7CX_LARGE_WRITE_CHUNK ? VL53L7CX_LARGE_WRITE_CHUNK : size - i);
+
+      buffer[0] = (uint8_t)((RegisterAddress + i) >> 8);
+      buffer[1] = (uint8_t)((RegisterAddress + i) & 0xFF);
+
+      i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+      i2c_master_start(cmd);
+      i2c_master_write_byte(cmd, (uint8_t)((p_platform->address & 0xFE) | I2C_MASTER_WRITE), true);
+      i2c_master_write(cmd, buffer, 2, true);
+      i2c_master_write(cmd, p_values + i, current_write_size, true);
+      i2c_master_stop(cmd);
+      // 4KB takes ~45ms at 800kHz; leave room for waiting on other bus users
+      esp_err_t err = i2c_master_cmd_begin((i2c_port_t)p_platform->i2c_port, cmd, pdMS_TO_TICKS(500));
+      i2c_cmd_link_delete(cmd);
+      if (err != ESP_OK) {
+        return 1;
+      }
+      i += current_write_size;
+    }
+    return 0;
+  }
+#endif
+
   while (i < size) {
     // If still more than DEFAULT_I2C_BUFFER_LEN bytes to go, DEFAULT_I2C_BUFFER_LEN,
     // else the remaining number of bytes
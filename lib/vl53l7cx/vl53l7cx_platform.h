@@ -59,6 +59,13 @@
   #endif
 #endif
 
+/* Largest single I2C transaction of the ESP-IDF write path (see WrMulti). Big
+ * enough that the ~84KB firmware upload is a handful of transactions, small
+ * enough that other devices on the bus are not locked out for long. */
+#ifndef VL53L7CX_LARGE_WRITE_CHUNK
+  #define VL53L7CX_LARGE_WRITE_CHUNK 4096U
+#endif
+
 /**
  * @brief Structure VL53L7CX_Platform needs to be filled by the customer,
  * depending on his platform. At least, it contains the VL53L7CX I2C address.
@@ -76,6 +83,9 @@ typedef struct {
 
   int i2c_rst_pin;
 
+  // ESP-IDF I2C port behind dev_i2c, or -1 to write through TwoWire only
+  int i2c_port;
+
   // Non-blocking timing support
   unsigned long wait_start_time;
   unsigned long wait_duration;
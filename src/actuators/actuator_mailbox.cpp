@@ -0,0 +1,121 @@
+#include "actuator_mailbox.h"
+
+#include "actuators/led/rgb_led.h"
+#include "actuators/motor_driver.h"
+
+void ActuatorMailbox::post_motor_pwm(int16_t left_pwm, int16_t right_pwm) {
+    _motorPwm.post(MotorPwmCommand{left_pwm, right_pwm});
+
+    // Wake the motor task so joystick-to-wheel latency doesn't depend on where it is in its 2ms sleep
+    if (_motorTaskHandle != nullptr) {
+        xTaskNotifyGive(_motorTaskHandle);
+    }
+}
+
+void ActuatorMailbox::post_led_colors(const NewLightColors& colors) {
+    _ledColors.post(colors);
+}
+
+void ActuatorMailbox::post_headlights(HeadlightStatus status) {
+    _headlights.post(status);
+}
+
+void ActuatorMailbox::post_display_buffer(const uint8_t* buffer) {
+    _displayBuffer.post(buffer); // Copied into the mailbox; the caller's buffer is not retained
+}
+
+void ActuatorMailbox::register_motor_task(TaskHandle_t task_handle) {
+    _motorTaskHandle = task_handle;
+}
+
+void ActuatorMailbox::apply_pending_motor_command() {
+    MotorPwmCommand command{};
+    if (_motorPwm.take(command)) {
+        motor_driver.update_motor_pwm(command.leftPwm, command.rightPwm);
+    }
+}
+
+void ActuatorMailbox::apply_pending_led_commands() {
+    NewLightColors colors;
+    if (_ledColors.take(colors)) {
+        apply_led_colors(colors);
+    }
+
+    HeadlightStatus status = HeadlightStatus::OFF;
+    if (_headlights.take(status)) {
+        if (status == HeadlightStatus::ON) {
+            rgb_led.turn_headlights_on();
+        } else {
+            rgb_led.turn_headlights_off();
+        }
+    }
+}
+
+void ActuatorMailbox::apply_pending_display_buffer() {
+    const uint8_t* buffer = _displayBuffer.take();
+    if (buffer != nullptr) {
+        DisplayScreen::show_custom_buffer(buffer);
+    }
+}
+
+void ActuatorMailbox::discard_pending_motor_command() {
+    _motorPwm.discard();
+}
+
+void ActuatorMailbox::discard_pending_led_commands() {
+    _ledColors.discard();
+    _headlights.discard();
+}
+
+void ActuatorMailbox::discard_pending_led_colors() {
+    _ledColors.discard();
+}
+
+void ActuatorMailbox::discard_pending_display_buffer() {
+    _displayBuffer.discard();
+}
+
+void ActuatorMailbox::discard_all_pending() {
+    discard_pending_motor_command();
+    discard_pending_led_commands();
+    discard_pending_display_buffer();
+}
+
+uint32_t ActuatorMailbox::get_posted_count(ActuatorChannel channel) const {
+    switch (channel) {
+        case ActuatorChannel::MOTOR_PWM:
+            return _motorPwm.get_posted_count();
+        case ActuatorChannel::LED_COLORS:
+            return _ledColors.get_posted_count();
+        case ActuatorChannel::HEADLIGHTS:
+            return _headlights.get_posted_count();
+        case ActuatorChannel::DISPLAY_BUFFER:
+            return _displayBuffer.get_posted_count();
+        default:
+            return 0;
+    }
+}
+
+uint32_t ActuatorMailbox::get_superseded_count(ActuatorChannel channel) const {
+    switch (channel) {
+        case ActuatorChannel::MOTOR_PWM:
+            return _motorPwm.get_superseded_count();
+        case ActuatorChannel::LED_COLORS:
+            return _ledColors.get_superseded_count();
+        case ActuatorChannel::HEADLIGHTS:
+            return _headlights.get_superseded_count();
+        case ActuatorChannel::DISPLAY_BUFFER:
+            return _displayBuffer.get_superseded_count();
+        default:
+            return 0;
+    }
+}
+
+void ActuatorMailbox::apply_led_colors(const NewLightColors& colors) {
+    rgb_led.set_top_left_led(colors.topLeftRed, colors.topLeftGreen, colors.topLeftBlue);
+    rgb_led.set_top_right_led(colors.topRightRed, colors.topRightGreen, colors.topRightBlue);
+    rgb_led.set_middle_left_led(colors.middleLeftRed, colors.middleLeftGreen, colors.middleLeftBlue);
+    rgb_led.set_middle_right_led(colors.middleRightRed, colors.middleRightGreen, colors.middleRightBlue);
+    rgb_led.set_back_left_led(colors.backLeftRed, colors.backLeftGreen, colors.backLeftBlue);
+    rgb_led.set_back_right_led(colors.backRightRed, colors.backRightGreen, colors.backRightBlue);
+}
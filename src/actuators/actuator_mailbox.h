@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "actuators/display_screen.h"
+#include "networking/protocol.h"
+#include "utils/latest_value_mailbox.h"
+#include "utils/singleton.h"
+
+// Latest-value-wins hand-off between the command parsers (serial / WebSocket tasks) and the actuator tasks.
+// High-rate idempotent commands (joystick PWM, LED colors, headlights, display frames) are posted here and applied
+// by the owning task, so a burst of stale commands collapses into the newest one instead of queueing up.
+enum class ActuatorChannel : uint8_t { MOTOR_PWM, LED_COLORS, HEADLIGHTS, DISPLAY_BUFFER, COUNT };
+
+struct MotorPwmCommand {
+    int16_t leftPwm;
+    int16_t rightPwm;
+};
+
+class ActuatorMailbox : public Singleton<ActuatorMailbox> {
+    friend class Singleton<ActuatorMailbox>;
+
+  public:
+    // Producers (any task)
+    void post_motor_pwm(int16_t left_pwm, int16_t right_pwm);
+    void post_led_colors(const NewLightColors& colors);
+    void post_headlights(HeadlightStatus status);
+    void post_display_buffer(const uint8_t* buffer);
+
+    // Consumers - each is called only from the task that owns the actuator
+    void register_motor_task(TaskHandle_t task_handle);
+    void apply_pending_motor_command();
+    void apply_pending_led_commands();
+    void apply_pending_display_buffer();
+
+    // Drop anything not yet applied. Used when the actuator is being stopped/reset, and by commands that drive the same
+    // actuator directly, so a stale frame still in the mailbox can't land after them
+    void discard_pending_motor_command();
+    void discard_pending_led_commands();
+    void discard_pending_led_colors();
+    void discard_pending_display_buffer();
+    void discard_all_pending();
+
+    uint32_t get_posted_count(ActuatorChannel channel) const;
+    uint32_t get_superseded_count(ActuatorChannel channel) const;
+
+  private:
+    ActuatorMailbox() = default;
+
+    static void apply_led_colors(const NewLightColors& colors);
+
+    LatestValueMailbox<MotorPwmCommand> _motorPwm;
+    LatestValueMailbox<NewLightColors> _ledColors;
+    LatestValueMailbox<HeadlightStatus> _headlights;
+    LatestFrameMailbox<DISPLAY_BUFFER_SIZE> _displayBuffer;
+
+    TaskHandle_t _motorTaskHandle = nullptr;
+};
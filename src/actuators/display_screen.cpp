@@ -59,8 +59,12 @@ void DisplayScreen::update() {
         instance._skippedUpdates++;
         return;
     }
-    // Content changed - update display (I2C operation)
-    instance._display.display();
+    // Content changed - update display (I2C operation). The 1 KB frame is the bulkiest transfer on Wire, so it goes
+    // out behind any sensor traffic that is waiting
+    {
+        I2cBusLease lease(instance._busDevice, I2cPriority::BACKGROUND);
+        instance._display.display();
+    }
 
     // Copy new content to current buffer for next comparison
     copy_current_buffer();
@@ -8,6 +8,7 @@
 #include "networking/serial_queue_manager.h"
 #include "sensors/sensor_data_buffer.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/preferences_manager.h"
 #include "utils/singleton.h"
 #include "utils/structs.h"
@@ -62,6 +63,7 @@ class DisplayScreen : public Singleton<DisplayScreen> {
 
     // Display object
     Adafruit_SSD1306 _display;
+    I2cDevice _busDevice{I2cBusId::BUS_1, SCREEN_ADDRESS, "Display"};
 
     // State flags
     bool _initialized = false;
@@ -1,5 +1,7 @@
 #include "motor_driver.h"
 
+#include "actuators/actuator_mailbox.h"
+
 MotorDriver motor_driver;
 
 MotorDriver::MotorDriver() {
@@ -315,6 +317,7 @@ void MotorDriver::reset_command_state(bool absolute_brake) {
     _has_next_command = false;
     _next_left_pwm = 0;
     _next_right_pwm = 0;
+    ActuatorMailbox::get_instance().discard_pending_motor_command(); // A joystick sample still in flight must not restart the motors
     StraightLineDrive::get_instance().disable();
 
     // Apply brakes after clearing state
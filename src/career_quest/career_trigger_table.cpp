@@ -0,0 +1,268 @@
+#include "career_trigger_table.h"
+
+#include "actuators/dance_manager.h"
+#include "actuators/display_screen.h"
+#include "actuators/led/led_animations.h"
+#include "actuators/led/rgb_led.h"
+#include "actuators/motor_driver.h"
+#include "actuators/speaker.h"
+#include "career_quest/career_quest_triggers.h"
+#include "games/game_manager.h"
+#include "networking/send_sensor_data.h"
+#include "networking/serial_queue_manager.h"
+#include "sensors/pose_estimator.h"
+#include "sensors/sensor_data_buffer.h"
+
+namespace career_trigger_table {
+
+namespace {
+
+using TriggerHandler = void (*)();
+
+struct CareerTriggers {
+    const TriggerHandler* handlers;
+    uint8_t count;
+    const char* unknownTriggerMessage;
+};
+
+void meet_pip_enter_career() {
+    DisplayScreen::get_instance().turn_display_off();
+    Speaker::get_instance().stop_all_sounds();
+    led_animations.fade_out();
+    rgb_led.turn_headlights_off();
+}
+
+void meet_pip_s2_p1_enter() {
+    career_quest_triggers.start_s2_p1_sequence();
+}
+
+void meet_pip_s2_p1_exit() {
+    CareerQuestTriggers::stop_s2_p1_sequence();
+}
+
+void meet_pip_s2_p4_enter() {
+    career_quest_triggers.start_s2_p4_light_show();
+}
+
+void meet_pip_s2_p4_exit() {
+    CareerQuestTriggers::stop_s2_p4_light_show();
+}
+
+void meet_pip_s3_p3_enter() {
+    career_quest_triggers.start_s3_p3_display_demo();
+}
+
+void meet_pip_s3_p3_exit() {
+    career_quest_triggers.stop_s3_p3_display_demo();
+}
+
+void meet_pip_s4_p4_exit() {
+    Speaker::get_instance().stop_all_sounds();
+}
+
+void meet_pip_s4_p5_enter() {
+    Speaker::get_instance().start_entertainer_melody();
+}
+
+void meet_pip_s4_p5_exit() {
+    Speaker::get_instance().stop_all_sounds();
+}
+
+void meet_pip_s5_p4_enter() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_euler_data_enabled(true);
+    SendSensorData::get_instance().set_accel_data_enabled(true);
+    career_quest_triggers.start_s5_p4_led_visualization();
+}
+
+void meet_pip_s5_p4_exit() {
+    SendSensorData::get_instance().set_euler_data_enabled(false);
+    SendSensorData::get_instance().set_accel_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+    CareerQuestTriggers::stop_s5_p4_led_visualization();
+}
+
+void meet_pip_s5_p5_enter() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_euler_data_enabled(true);
+}
+
+void meet_pip_s5_p5_exit() {
+    SendSensorData::get_instance().set_euler_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+}
+
+void meet_pip_s6_p4_enter() {
+    SendSensorData::get_instance().set_send_multizone_data(true);
+    rgb_led.turn_headlights_faint_blue();
+}
+
+void meet_pip_s6_p4_exit() {
+    SendSensorData::get_instance().set_send_multizone_data(false);
+    rgb_led.turn_headlights_off();
+}
+
+void meet_pip_s6_p6_enter() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_side_tof_data_enabled(true);
+    rgb_led.turn_front_middle_leds_faint_blue();
+}
+
+void meet_pip_s6_p6_exit() {
+    SendSensorData::get_instance().set_side_tof_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+    rgb_led.turn_front_middle_leds_off();
+}
+
+void meet_pip_s7_p4_enter() {
+    career_quest_triggers.start_s7_p4_button_demo();
+}
+
+void meet_pip_s7_p4_exit() {
+    CareerQuestTriggers::stop_s7_p4_button_demo();
+}
+
+void meet_pip_s7_p6_enter() {
+    GameManager::get_instance().start_game(games::GameType::DINO_RUNNER);
+}
+
+void meet_pip_s7_p6_exit() {
+    GameManager::get_instance().stop_current_game();
+}
+
+void meet_pip_s8_p3_enter() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_color_sensor_data_enabled(true);
+}
+
+void meet_pip_s8_p3_exit() {
+    SendSensorData::get_instance().set_color_sensor_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+    SensorDataBuffer::get_instance().stop_polling_sensor(SensorDataBuffer::SensorType::COLOR);
+}
+
+void meet_pip_s9_p3_enter() {
+    DanceManager::get_instance().start_dance();
+}
+
+void meet_pip_s9_p3_exit() {
+    DanceManager::get_instance().stop_dance(true);
+}
+
+void meet_pip_s9_p6_enter() {
+    motor_driver.stop_both_motors(); // We need this to prevent students from turning against the motors.
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_encoder_data_enabled(true);
+    rgb_led.turn_headlights_faint_blue();
+}
+
+void meet_pip_s9_p6_exit() {
+    SendSensorData::get_instance().set_encoder_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+    rgb_led.turn_back_leds_off();
+}
+
+void enter_turret_arcade() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_euler_data_enabled(true);
+    SendSensorData::get_instance().set_side_tof_data_enabled(true);
+}
+
+void exit_turret_arcade() {
+    SendSensorData::get_instance().set_euler_data_enabled(false);
+    SendSensorData::get_instance().set_side_tof_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+}
+
+void enter_flappy_bird_arcade() {
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_front_distance_data_enabled(true);
+}
+
+void exit_flappy_bird_arcade() {
+    SendSensorData::get_instance().set_front_distance_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+}
+
+void enter_city_driving_arcade() {
+    PoseEstimator::get_instance().reset(); // The car starts at the map origin
+    SendSensorData::get_instance().set_send_sensor_data(true);
+    SendSensorData::get_instance().set_encoder_data_enabled(true);
+    SendSensorData::get_instance().set_pose_data_enabled(true);
+}
+
+void exit_city_driving_arcade() {
+    SendSensorData::get_instance().set_pose_data_enabled(false);
+    SendSensorData::get_instance().set_encoder_data_enabled(false);
+    SendSensorData::get_instance().set_send_sensor_data(false);
+}
+
+// Indexed by MeetPipTriggerType (values are not in lesson order, so keep this table sorted by value)
+const TriggerHandler MEET_PIP_TRIGGERS[] = {
+    meet_pip_enter_career, // 0: ENTER_CAREER
+    meet_pip_s2_p1_enter,  // 1: S2_P1_ENTER
+    meet_pip_s2_p1_exit,   // 2: S2_P1_EXIT
+    meet_pip_s2_p4_enter,  // 3: S2_P4_ENTER
+    meet_pip_s2_p4_exit,   // 4: S2_P4_EXIT
+    meet_pip_s3_p3_enter,  // 5: S3_P3_ENTER
+    meet_pip_s3_p3_exit,   // 6: S3_P3_EXIT
+    meet_pip_s4_p5_enter,  // 7: S4_P5_ENTER
+    meet_pip_s5_p4_enter,  // 8: S5_P4_ENTER
+    meet_pip_s5_p4_exit,   // 9: S5_P4_EXIT
+    meet_pip_s5_p5_enter,  // 10: S5_P5_ENTER
+    meet_pip_s5_p5_exit,   // 11: S5_P5_EXIT
+    meet_pip_s6_p4_enter,  // 12: S6_P4_ENTER
+    meet_pip_s6_p4_exit,   // 13: S6_P4_EXIT
+    meet_pip_s6_p6_enter,  // 14: S6_P6_ENTER
+    meet_pip_s6_p6_exit,   // 15: S6_P6_EXIT
+    meet_pip_s7_p4_enter,  // 16: S7_P4_ENTER
+    meet_pip_s7_p4_exit,   // 17: S7_P4_EXIT
+    meet_pip_s7_p6_enter,  // 18: S7_P6_ENTER
+    meet_pip_s7_p6_exit,   // 19: S7_P6_EXIT
+    meet_pip_s8_p3_enter,  // 20: S8_P3_ENTER
+    meet_pip_s8_p3_exit,   // 21: S8_P3_EXIT
+    meet_pip_s9_p3_enter,  // 22: S9_P3_ENTER
+    meet_pip_s9_p6_enter,  // 23: S9_P6_ENTER
+    meet_pip_s9_p6_exit,   // 24: S9_P6_EXIT
+    meet_pip_s4_p5_exit,   // 25: S4_P5_EXIT
+    meet_pip_s9_p3_exit,   // 26: S9_P3_EXIT
+    meet_pip_s4_p4_exit,   // 27: S4_P4_EXIT
+};
+
+const TriggerHandler TURRET_ARCADE_TRIGGERS[] = {enter_turret_arcade, exit_turret_arcade};
+const TriggerHandler FLAPPY_BIRD_ARCADE_TRIGGERS[] = {enter_flappy_bird_arcade, exit_flappy_bird_arcade};
+const TriggerHandler CITY_DRIVING_ARCADE_TRIGGERS[] = {enter_city_driving_arcade, exit_city_driving_arcade};
+
+static_assert(sizeof(MEET_PIP_TRIGGERS) / sizeof(TriggerHandler) == static_cast<uint8_t>(MeetPipTriggerType::S4_P4_EXIT) + 1,
+              "MEET_PIP_TRIGGERS must have one entry per MeetPipTriggerType");
+
+// Indexed by CareerType (MEET_PIP = 1); slot 0 is unused
+const CareerTriggers CAREERS[] = {
+    {nullptr, 0, nullptr},
+    {MEET_PIP_TRIGGERS, sizeof(MEET_PIP_TRIGGERS) / sizeof(TriggerHandler), "Unknown introduction trigger type"},
+    {TURRET_ARCADE_TRIGGERS, 2, "Unknown turret arcade trigger type"},
+    {FLAPPY_BIRD_ARCADE_TRIGGERS, 2, "Unknown flappy bird arcade trigger type"},
+    {CITY_DRIVING_ARCADE_TRIGGERS, 2, "Unknown city driving arcade trigger type"},
+};
+
+constexpr uint8_t CAREER_COUNT = sizeof(CAREERS) / sizeof(CareerTriggers);
+
+} // namespace
+
+void dispatch(CareerType career_type, uint8_t trigger_type) {
+    const auto CAREER_INDEX = static_cast<uint8_t>(career_type);
+    if (CAREER_INDEX >= CAREER_COUNT || CAREERS[CAREER_INDEX].handlers == nullptr) {
+        SerialQueueManager::get_instance().queue_message("Unknown career type");
+        return;
+    }
+
+    const CareerTriggers& career = CAREERS[CAREER_INDEX];
+    if (trigger_type >= career.count || career.handlers[trigger_type] == nullptr) {
+        SerialQueueManager::get_instance().queue_message(career.unknownTriggerMessage);
+        return;
+    }
+
+    career.handlers[trigger_type]();
+}
+
+} // namespace career_trigger_table
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "networking/protocol.h"
+
+namespace career_trigger_table {
+
+// Looks up the career's trigger in a constant table (stored in flash) and runs it.
+// Unknown careers and out-of-range triggers are logged and ignored.
+void dispatch(CareerType career_type, uint8_t trigger_type);
+
+} // namespace career_trigger_table
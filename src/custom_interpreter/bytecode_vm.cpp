@@ -291,16 +291,14 @@ void BytecodeVM::execute_instruction(const BytecodeInstruction& instr) {
                         value = SensorDataBuffer::get_instance().get_latest_magnetic_field_z();
                         break;
                     case SENSOR_SIDE_LEFT_PROXIMITY: {
-                        uint16_t counts = SensorDataBuffer::get_instance().get_latest_left_side_tof_counts();
-                        _registers[reg_id].asBool = (counts > LEFT_PROXIMITY_THRESHOLD);
+                        _registers[reg_id].asBool = SensorDataBuffer::get_instance().is_left_side_object_near();
                         _registerTypes[reg_id] = VAR_BOOL;
                         _registerInitialized[reg_id] = true;
                         skip_default_assignment = true; // Set flag to skip default assignment
                         break;
                     }
                     case SENSOR_SIDE_RIGHT_PROXIMITY: {
-                        uint16_t counts = SensorDataBuffer::get_instance().get_latest_right_side_tof_counts();
-                        _registers[reg_id].asBool = (counts > RIGHT_PROXIMITY_THRESHOLD);
+                        _registers[reg_id].asBool = SensorDataBuffer::get_instance().is_right_side_object_near();
                         _registerTypes[reg_id] = VAR_BOOL;
                         _registerInitialized[reg_id] = true;
                         skip_default_assignment = true; // Set flag to skip default assignment
@@ -368,9 +366,7 @@ void BytecodeVM::execute_instruction(const BytecodeInstruction& instr) {
                         break;
                     }
                     default: {
-                        char log_message[32];
-                        snprintf(log_message, sizeof(log_message), "Unknown sensor type: %u", sensor_type);
-                        SerialQueueManager::get_instance().queue_message(log_message);
+                        SerialQueueManager::get_instance().log(LogFormat::VM_UNKNOWN_SENSOR_TYPE, static_cast<unsigned>(sensor_type));
                         break;
                     }
                 }
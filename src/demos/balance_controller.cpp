@@ -12,9 +12,10 @@ void BalanceController::enable() {
     // Reset PID variables
     _errorSum = 0.0f;
     _lastError = 0.0f;
-    _lastUpdateTime = millis();
 
-    float current_angle = SensorDataBuffer::get_instance().get_latest_pitch();
+    const EulerAngles EULER = SensorDataBuffer::get_instance().get_latest_euler_angles();
+    float current_angle = EULER.pitch;
+    _lastSampleUs = EULER.timestampUs;
     _lastValidAngle = current_angle;
 
     // Initialize buffers with the current angle
@@ -55,8 +56,14 @@ void BalanceController::update() {
     // }
     // _lastUpdateTime = CURRENT_TIME;
 
-    // Get current pitch
-    float raw_angle = SensorDataBuffer::get_instance().get_latest_pitch();
+    // Get current pitch - only act on a new IMU sample, so a repeated one doesn't skew the averages below
+    const EulerAngles EULER = SensorDataBuffer::get_instance().get_latest_euler_angles();
+    if (EULER.timestampUs == _lastSampleUs) {
+        return;
+    }
+    _lastSampleUs = EULER.timestampUs;
+
+    float raw_angle = EULER.pitch;
     float current_angle = raw_angle;
 
     // Update safety monitoring buffer
@@ -31,7 +31,7 @@ class BalanceController : public Singleton<BalanceController> {
     float _lastValidAngle = 0.0F;
     float _lastError = 0.0F;
     float _errorSum = 0.0F;
-    uint32_t _lastUpdateTime = 0;
+    uint64_t _lastSampleUs = 0; // IMU sample time of the last pitch used, to skip repeated samples
 
     // Fixed parameters - not configurable as per your request
     float _target_angle = 93.6F; // Fixed target angle
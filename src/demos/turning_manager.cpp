@@ -28,22 +28,20 @@ void TurningManager::initialize_turn() {
     instance._targetVelocity = 0.0f;
     instance._lastHeading = 0.0f;
     instance._lastHeadingForRotation = 0.0f;
-    instance._lastTime = 0;
+    instance._lastHeadingUs = 0;
     instance._completionStartTime = 0;
     instance._completionConfirmed = false;
     instance._currentDirection = TurningDirection::NONE;
     instance._currentPWM = 0;
     instance._integralTerm = 0.0f;
-    instance._lastIntegralTime = 0;
+    instance._lastIntegralUs = 0;
     instance._kpContribution = 0.0f;
     instance._kiContribution = 0.0f;
     instance._overshootBrakeStartTime = 0;
 
     instance._currentState = TurningState::TURNING;
 
-    char log_message[64];
-    snprintf(log_message, sizeof(log_message), "Starting turn: %.1f degrees", instance._targetTurnAngle);
-    SerialQueueManager::get_instance().queue_message(log_message);
+    SerialQueueManager::get_instance().log(LogFormat::TURN_STARTED, instance._targetTurnAngle);
 }
 
 void TurningManager::update() {
@@ -72,9 +70,7 @@ void TurningManager::update() {
 
     // Check for overshoot at high speed
     if (check_overshoot(REMAINING_ANGLE)) {
-        char log_message[80];
-        snprintf(log_message, sizeof(log_message), "High-speed overshoot detected! Braking for %dms", static_cast<int>(OVERSHOOT_BRAKE_DURATION));
-        SerialQueueManager::get_instance().queue_message(log_message);
+        SerialQueueManager::get_instance().log(LogFormat::TURN_OVERSHOOT_BRAKING, static_cast<int>(OVERSHOOT_BRAKE_DURATION));
         instance._currentState = TurningState::OVERSHOOT_BRAKING;
         instance._overshootBrakeStartTime = millis();
         motor_driver.brake_both_motors();
@@ -115,28 +111,30 @@ void TurningManager::update() {
 
 void TurningManager::update_velocity() {
     TurningManager& instance = TurningManager::get_instance();
-    float current_heading = -SensorDataBuffer::get_instance().get_latest_yaw();
-    const uint32_t CURRENT_TIME = millis();
-
-    if (instance._lastTime != 0) {
-        const float DELTA_TIME = (CURRENT_TIME - instance._lastTime) / 1000.0f;
-        if (DELTA_TIME > 0) {
-            float delta_heading = current_heading - instance._lastHeading;
+    const EulerAngles EULER = SensorDataBuffer::get_instance().get_latest_euler_angles();
+    float current_heading = -EULER.yaw;
 
-            // Handle wrap-around
-            while (delta_heading > 180.0f) {
-                delta_heading -= 360.0f;
-            }
-            while (delta_heading < -180.0f) {
-                delta_heading += 360.0f;
-            }
+    // dt between the IMU's own sample times, so a late task wake-up doesn't read as a velocity change
+    if (instance._lastHeadingUs != 0) {
+        if (EULER.timestampUs <= instance._lastHeadingUs) {
+            return; // Same sample as last time
+        }
+        const float DELTA_TIME = (EULER.timestampUs - instance._lastHeadingUs) / 1000000.0f;
+        float delta_heading = current_heading - instance._lastHeading;
 
-            instance._currentVelocity = delta_heading / DELTA_TIME;
+        // Handle wrap-around
+        while (delta_heading > 180.0f) {
+            delta_heading -= 360.0f;
+        }
+        while (delta_heading < -180.0f) {
+            delta_heading += 360.0f;
         }
+
+        instance._currentVelocity = delta_heading / DELTA_TIME;
     }
 
     instance._lastHeading = current_heading;
-    instance._lastTime = CURRENT_TIME;
+    instance._lastHeadingUs = EULER.timestampUs;
 }
 
 void TurningManager::update_cumulative_rotation() {
@@ -190,11 +188,11 @@ float TurningManager::calculate_velocity_error() const {
 uint16_t TurningManager::calculate_pwm(float velocity_error) {
     TurningManager& instance = TurningManager::get_instance();
     // Calculate deltaTime for integral term
-    const uint32_t CURRENT_TIME = millis();
+    const uint64_t CURRENT_TIME_US = micros64();
     float delta_time = 0.0f;
 
-    if (instance._lastIntegralTime != 0) {
-        delta_time = (CURRENT_TIME - instance._lastIntegralTime) / 1000.0f;
+    if (instance._lastIntegralUs != 0) {
+        delta_time = (CURRENT_TIME_US - instance._lastIntegralUs) / 1000000.0f;
 
         // Accumulate integral term
         instance._integralTerm += velocity_error * delta_time;
@@ -204,7 +202,7 @@ uint16_t TurningManager::calculate_pwm(float velocity_error) {
         instance._integralTerm = constrain(instance._integralTerm, -MAX_INTEGRAL, MAX_INTEGRAL);
     }
 
-    instance._lastIntegralTime = CURRENT_TIME;
+    instance._lastIntegralUs = CURRENT_TIME_US;
 
     // Calculate individual contributions
     instance._kpContribution = KP_VELOCITY * velocity_error;
@@ -225,9 +223,7 @@ bool TurningManager::check_completion() {
         // Start confirmation timer if not already started
         if (_completionStartTime == 0) {
             _completionStartTime = millis();
-            char log_message[80];
-            snprintf(log_message, sizeof(log_message), "Approaching completion: Remaining=%.2f°, Vel=%.2f°/s", REMAINING_ANGLE, _currentVelocity);
-            SerialQueueManager::get_instance().queue_message(log_message);
+            SerialQueueManager::get_instance().log(LogFormat::TURN_APPROACHING_COMPLETION, REMAINING_ANGLE, _currentVelocity);
         }
 
         // Check if we've been in completion zone for required time
@@ -235,9 +231,7 @@ bool TurningManager::check_completion() {
             if (!_completionConfirmed) {
                 _completionConfirmed = true;
                 motor_driver.brake_both_motors();
-                char log_message[80];
-                snprintf(log_message, sizeof(log_message), "Turn complete! Final error: %.2f°", REMAINING_ANGLE);
-                SerialQueueManager::get_instance().queue_message(log_message);
+                SerialQueueManager::get_instance().log(LogFormat::TURN_COMPLETE, REMAINING_ANGLE);
                 return true;
             }
         }
@@ -297,10 +291,7 @@ bool TurningManager::check_overshoot(float remaining_angle) {
         const float TIME_TO_TARGET = abs(remaining_angle) / abs(instance._currentVelocity) * 1000.0f; // ms
 
         if (TIME_TO_TARGET < 10.0f && abs(remaining_angle) > COMPLETION_POSITION_THRESHOLD + 1.0f) {
-            char log_message[120];
-            snprintf(log_message, sizeof(log_message), "PREDICTIVE: Too fast! Time to target: %.1fms, Remaining: %.1f°, Vel: %.1f°/s", TIME_TO_TARGET,
-                     remaining_angle, instance._currentVelocity);
-            SerialQueueManager::get_instance().queue_message(log_message);
+            SerialQueueManager::get_instance().log(LogFormat::TURN_PREDICTIVE_TOO_FAST, TIME_TO_TARGET, remaining_angle, instance._currentVelocity);
             return true;
         }
     }
@@ -319,12 +310,12 @@ void TurningManager::reset_turn_state() {
     _targetVelocity = 0.0f;
     _lastHeading = 0.0f;
     _lastHeadingForRotation = 0.0f;
-    _lastTime = 0;
+    _lastHeadingUs = 0;
     _completionStartTime = 0;
     _completionConfirmed = false;
     _currentPWM = 0;
     _integralTerm = 0.0f;
-    _lastIntegralTime = 0;
+    _lastIntegralUs = 0;
     _kpContribution = 0.0f;
     _kiContribution = 0.0f;
     _overshootBrakeStartTime = 0;
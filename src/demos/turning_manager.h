@@ -69,8 +69,8 @@ class TurningManager : public Singleton<TurningManager> {
     float _currentVelocity = 0.0f;
     float _targetVelocity = 0.0f;
     float _lastHeading = 0.0f;
-    uint32_t _lastTime = 0;
-    uint32_t _lastIntegralTime = 0;
+    uint64_t _lastHeadingUs = 0; // Sample time of _lastHeading
+    uint64_t _lastIntegralUs = 0;
 
     // Control
     uint16_t _currentPWM = 0;
@@ -27,6 +27,9 @@ void setup() {
     // Initialize
     Wire.begin(I2C_SDA_1, I2C_SCL_1, I2C_1_CLOCK_SPEED);
 
+    // From here on, sensor and display traffic on both buses is scheduled by priority (boot-time init still goes direct)
+    TaskManager::create_i2c_bus_tasks();
+
     // Check hold-to-wake condition first (handles display init for deep sleep wake)
     // Function handles going back to sleep if conditions aren't met
     if (!hold_to_wake()) {
@@ -74,7 +77,9 @@ void setup() {
     TaskManager::create_network_management_task();
 
     // 8. WebSocket polling (separate from communication for non-blocking sensor data)
-    TaskManager::create_sensor_web_socket_task();  // NEW: For sensor data only
+    if (!USE_MULTIPLEXED_WEBSOCKET) {
+        TaskManager::create_sensor_web_socket_task(); // NEW: For sensor data only
+    }
     TaskManager::create_command_web_socket_task(); // NEW: For commands + ping/pong
     TaskManager::create_heartbeat_task();          // Sends through command connection
 
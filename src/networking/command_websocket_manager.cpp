@@ -2,59 +2,112 @@
 
 #include "actuators/display_screen.h"
 #include "networking/send_sensor_data.h"
+#include "networking/wifi_manager.h"
 #include "utils/config.h"
 #include "utils/structs.h"
 
 CommandWebSocketManager::CommandWebSocketManager() {
     _wsConnected = false;
-    _lastConnectionAttempt = 0;
     String pip_id = PreferencesManager::get_instance().get_pip_id();
     _wsClient.addHeader("X-Pip-Id", pip_id);
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        _outbox.initialize(true);
+        _outbox.enable_channel(WsChannel::CONTROL);
+        _outbox.enable_channel(WsChannel::COMMAND);
+        _outbox.enable_channel(WsChannel::TELEMETRY);
+    }
     if (DEFAULT_ENVIRONMENT == "local") {
         return;
     }
     _wsClient.setCACert(ROOT_CA_CERTIFICATE);
 }
 
-void CommandWebSocketManager::handle_binary_message(WebsocketsMessage message) {
+void CommandWebSocketManager::handle_websocket_message(const WebsocketsMessage& message) {
     const auto* data = reinterpret_cast<const uint8_t*>(message.c_str());
     const uint16_t LENGTH = message.length();
 
-    // Check if this is a framed message (starts with START_MARKER)
-    if (LENGTH >= 4 && data[0] == START_MARKER) {
-        const uint8_t MESSAGE_TYPE = data[1];
-        const bool USE_LONG_FORMAT = (data[2] != 0);
+    if (!USE_MULTIPLEXED_WEBSOCKET) {
+        handle_command_frames(data, LENGTH);
+        return;
+    }
+
+    // Multiplexed: strip the channel header. Only the command channel carries anything for the robot today
+    if (LENGTH <= WS_CHANNEL_HEADER_SIZE) {
+        return;
+    }
+    const auto CHANNEL = static_cast<WsChannel>(data[0]);
+    if (CHANNEL != WsChannel::COMMAND) {
+        SerialQueueManager::get_instance().queue_message("[WS_CMD] Ignoring message on channel " + String(data[0]));
+        return;
+    }
+    handle_command_frames(data + WS_CHANNEL_HEADER_SIZE, LENGTH - WS_CHANNEL_HEADER_SIZE);
+}
 
-        uint16_t payload_length = 0;
-        uint16_t header_size = 0;
+void CommandWebSocketManager::handle_command_frames(const uint8_t* data, uint16_t length) {
+    CommandWebSocketManager& instance = CommandWebSocketManager::get_instance();
 
-        if (USE_LONG_FORMAT) {
-            payload_length = data[3] | (data[4] << 8);
-            header_size = 5;
-        } else {
-            payload_length = data[3];
-            header_size = 4;
+    // A message may carry several back-to-back frames (pipelined v2 frames from the host)
+    uint16_t offset = 0;
+    while (offset < length && (data[offset] == START_MARKER || data[offset] == START_MARKER_V2)) {
+        ParsedFrame frame;
+        const FrameParseResult RESULT = FrameParser::parse(data + offset, length - offset, frame);
+        if (RESULT != FrameParseResult::COMPLETE) {
+            if (frame.isV2) {
+                send_frame_nack(instance._rxSequence.next_expected(), RESULT);
+            }
+            SerialQueueManager::get_instance().queue_message("[WS_CMD] Invalid framed message");
+            return;
         }
+        offset += frame.frameSize;
 
-        if (LENGTH == header_size + payload_length + 1 && data[header_size + payload_length] == END_MARKER) {
-            auto* processed_data = new uint8_t[payload_length + 1];
-            processed_data[0] = MESSAGE_TYPE;
-
-            if (payload_length > 0) {
-                memcpy(processed_data + 1, data + header_size, payload_length);
+        if (frame.isV2) {
+            // ACK on receipt so the host can keep pipelining; retransmissions are re-ACKed but not re-run
+            send_frame_ack(frame.sequence);
+            if (!instance._rxSequence.accept(frame.sequence)) {
+                continue;
             }
+        }
 
-            MessageProcessor::get_instance().process_binary_message(processed_data, payload_length + 1);
+        // Payload is a view into the WebSocket message, which outlives this call
+        MessageProcessor::get_instance().process_message(static_cast<DataMessageType>(frame.messageType), frame.payload,
+                                                         frame.payloadLength);
+    }
+}
 
-            delete[] processed_data;
-        } else {
-            SerialQueueManager::get_instance().queue_message("[WS_CMD] Invalid framed message");
-        }
+void CommandWebSocketManager::send_frame_ack(uint8_t sequence) {
+    auto doc = make_base_message_common<96>(ToCommonMessage::FRAME_ACK);
+    JsonObject payload = doc.createNestedObject("payload");
+    payload["seq"] = sequence;
+    payload["ack"] = true;
+
+    String json_string;
+    serializeJson(doc, json_string);
+    send_message(json_string, WsChannel::CONTROL);
+}
+
+void CommandWebSocketManager::send_frame_nack(uint8_t expected_sequence, FrameParseResult reason) {
+    auto doc = make_base_message_common<128>(ToCommonMessage::FRAME_ACK);
+    JsonObject payload = doc.createNestedObject("payload");
+    payload["ack"] = false;
+    payload["expectedSeq"] = expected_sequence;
+    payload["reason"] = FrameParser::result_to_string(reason);
+
+    String json_string;
+    serializeJson(doc, json_string);
+    send_message(json_string, WsChannel::CONTROL);
+}
+
+void CommandWebSocketManager::send_message(const String& message, WsChannel channel) {
+    CommandWebSocketManager& instance = CommandWebSocketManager::get_instance();
+    if (!USE_MULTIPLEXED_WEBSOCKET) {
+        instance._wsClient.send(message);
+        return;
     }
+    instance._outbox.enqueue(channel, message.c_str(), message.length());
 }
 
 void CommandWebSocketManager::connect_to_websocket() {
-    _wsClient.onMessage([this](WebsocketsMessage message) { this->handle_binary_message(message); });
+    _wsClient.onMessage([](WebsocketsMessage message) { handle_websocket_message(message); });
 
     _wsClient.onEvent([this](WebsocketsEvent event, String data) {
         switch (event) {
@@ -63,25 +116,29 @@ void CommandWebSocketManager::connect_to_websocket() {
                 this->_wsConnected = true;
                 this->_hasKilledWiFiProcesses = false;
                 this->_lastPingTime = millis();
+                this->_rxSequence.reset();
+                this->_rttProbePending = false;
+                this->_outbox.clear(); // Nothing queued for a previous session is replayed on this one
                 this->send_initial_data();
                 break;
             case WebsocketsEvent::ConnectionClosed:
                 SerialQueueManager::get_instance().queue_message("[WS_CMD] Connection closed");
-                kill_wifi_processes();
-                this->_wsConnected = false;
+                this->on_connection_lost();
+                this->_outbox.clear();
                 break;
             case WebsocketsEvent::GotPing:
                 SerialQueueManager::get_instance().queue_message("[WS_CMD] Got ping");
                 this->_lastPingTime = millis();
                 break;
             case WebsocketsEvent::GotPong:
-                SerialQueueManager::get_instance().queue_message("[WS_CMD] Got pong");
+                // Pongs answer our own RTT probes every couple of seconds, so they are not logged
                 this->_lastPingTime = millis();
+                this->record_pong();
                 break;
         }
     });
 
-    _lastConnectionAttempt = 0;
+    _reconnect.schedule_fast_attempt(millis());
 }
 
 void CommandWebSocketManager::add_battery_data_to_payload(JsonObject& payload) {
@@ -117,7 +174,7 @@ void CommandWebSocketManager::send_initial_data() {
     String json_string;
     serializeJson(init_doc, json_string);
     WiFiClass::mode(WIFI_STA);
-    CommandWebSocketManager::get_instance()._wsClient.send(json_string);
+    send_message(json_string);
 }
 
 void CommandWebSocketManager::send_battery_monitor_data() {
@@ -132,13 +189,13 @@ void CommandWebSocketManager::send_battery_monitor_data() {
 
     String json_string;
     serializeJson(battery_doc, json_string);
-    instance._wsClient.send(json_string);
+    send_message(json_string);
 }
 
 void CommandWebSocketManager::poll_websocket() {
     CommandWebSocketManager& instance = CommandWebSocketManager::get_instance();
     const uint32_t CURRENT_TIME = millis();
-    if (CURRENT_TIME - instance._lastPollTime < POLL_INTERVAL) {
+    if (CURRENT_TIME - instance._lastPollTime < get_poll_interval_ms()) {
         return;
     }
 
@@ -147,28 +204,44 @@ void CommandWebSocketManager::poll_websocket() {
     if (WiFiClass::status() != WL_CONNECTED) {
         if (instance._wsConnected) {
             SerialQueueManager::get_instance().queue_message("[WS_CMD] WiFi lost", SerialPriority::HIGH_PRIO);
-            instance._wsConnected = false;
-            kill_wifi_processes();
+            instance.on_connection_lost();
         }
+        instance._wifiLost = true;
         return;
     }
 
+    if (instance._wifiLost) {
+        // WiFi just came back, so the server is most likely reachable - don't sit out the remaining backoff
+        instance._wifiLost = false;
+        instance._reconnect.schedule_fast_attempt(CURRENT_TIME);
+    }
+
     if (instance._wsConnected && (CURRENT_TIME - instance._lastPingTime >= WS_TIMEOUT)) {
         SerialQueueManager::get_instance().queue_message("[WS_CMD] Ping timeout", SerialPriority::HIGH_PRIO);
-        instance._wsConnected = false;
-        kill_wifi_processes();
+        instance.on_connection_lost();
     }
 
-    if (!instance._wsConnected && (CURRENT_TIME - instance._lastConnectionAttempt >= CONNECTION_INTERVAL)) {
-        instance._lastConnectionAttempt = CURRENT_TIME;
-
+    if (!instance._wsConnected && instance._reconnect.is_attempt_due(CURRENT_TIME)) {
         SerialQueueManager::get_instance().queue_message("[WS_CMD] Attempting to connect...");
 
-        if (!instance._wsClient.connect(get_ws_server_url())) {
-            SerialQueueManager::get_instance().queue_message("[WS_CMD] Connection failed");
+        String url = get_ws_server_url();
+        if (USE_MULTIPLEXED_WEBSOCKET) {
+            url.replace("/esp32", "/esp32-mux"); // Commands + telemetry on one connection
+        }
+
+        if (!instance._wsClient.connect(url)) {
+            instance._reconnect.on_attempt_failed(millis());
+            SerialQueueManager::get_instance().queue_message("[WS_CMD] Connection failed (attempt " +
+                                                             String(instance._reconnect.get_failed_attempts_in_outage()) + ")");
         } else {
-            SerialQueueManager::get_instance().queue_message("[WS_CMD] Connected successfully");
+            const uint32_t RECONNECT_MS = instance._reconnect.on_connected(millis());
             instance._wsConnected = true;
+            if (RECONNECT_MS > 0) {
+                SerialQueueManager::get_instance().queue_message("[WS_CMD] Reconnected after " + String(RECONNECT_MS) + " ms");
+            } else {
+                SerialQueueManager::get_instance().queue_message("[WS_CMD] Connected successfully");
+                WiFiManager::get_instance().report_boot_timing();
+            }
         }
         return;
     }
@@ -179,11 +252,42 @@ void CommandWebSocketManager::poll_websocket() {
 
     try {
         instance._wsClient.poll();
+        instance.probe_rtt(CURRENT_TIME);
+        if (USE_MULTIPLEXED_WEBSOCKET) {
+            instance._outbox.drain(instance._wsClient, MAX_SENDS_PER_POLL);
+        }
     } catch (const std::exception& e) {
         instance._wsConnected = false;
+        instance._reconnect.on_connection_lost(millis());
     }
 }
 
+void CommandWebSocketManager::on_connection_lost() {
+    _wsConnected = false;
+    _reconnect.on_connection_lost(millis());
+    kill_wifi_processes();
+}
+
+void CommandWebSocketManager::probe_rtt(uint32_t current_time) {
+    if (current_time - _lastRttProbe < RTT_PROBE_INTERVAL) {
+        return;
+    }
+    _lastRttProbe = current_time;
+    _rttProbeSentAt = millis();
+    _rttProbePending = _wsClient.ping();
+}
+
+void CommandWebSocketManager::record_pong() {
+    if (!_rttProbePending) {
+        return;
+    }
+    _rttProbePending = false;
+
+    // Smoothed like TCP's SRTT (alpha = 1/8)
+    const uint32_t SAMPLE = millis() - _rttProbeSentAt;
+    _rttMs = (_rttMs == 0) ? SAMPLE : _rttMs - (_rttMs / 8) + (SAMPLE / 8);
+}
+
 void CommandWebSocketManager::kill_wifi_processes() {
     CommandWebSocketManager& instance = CommandWebSocketManager::get_instance();
     if (instance._hasKilledWiFiProcesses) {
@@ -200,6 +304,7 @@ void CommandWebSocketManager::kill_wifi_processes() {
     SendSensorData::get_instance().set_accel_data_enabled(false);
     SendSensorData::get_instance().set_color_sensor_data_enabled(false);
     SendSensorData::get_instance().set_encoder_data_enabled(false);
+    SendSensorData::get_instance().set_pose_data_enabled(false);
 
     instance._hasKilledWiFiProcesses = true;
     instance._userConnectedToThisPip = false;
@@ -216,7 +321,7 @@ void CommandWebSocketManager::send_pip_turning_off() {
     payload["reason"] = "Pip is turning off";
     String json_string;
     serializeJson(pip_turning_off_doc, json_string);
-    instance._wsClient.send(json_string);
+    send_message(json_string);
 }
 
 void CommandWebSocketManager::send_dino_score(int score) {
@@ -231,7 +336,7 @@ void CommandWebSocketManager::send_dino_score(int score) {
 
     String json_string;
     serializeJson(doc, json_string);
-    instance._wsClient.send(json_string);
+    send_message(json_string);
 }
 
 void CommandWebSocketManager::set_is_user_connected_to_this_pip(bool new_is_user_connected_to_this_pip) {
@@ -6,9 +6,13 @@
 
 #include "custom_interpreter/bytecode_vm.h"
 #include "firmware_version_tracker.h"
+#include "frame_parser.h"
 #include "message_processor.h"
 #include "protocol.h"
+#include "reconnect_backoff.h"
+#include "websocket_outbox.h"
 #include "sensors/battery_monitor.h"
+#include "utils/config.h"
 #include "utils/preferences_manager.h"
 #include "utils/singleton.h"
 
@@ -25,6 +29,10 @@ class CommandWebSocketManager : public Singleton<CommandWebSocketManager> {
         return _wsConnected;
     }
 
+    // Sends on the command connection. In multiplexed mode the message is queued on the given channel and
+    // sent by the command WebSocket task; otherwise it is sent immediately on the caller's task.
+    static void send_message(const String& message, WsChannel channel = WsChannel::COMMAND);
+
     static void send_battery_monitor_data();
     static void send_pip_turning_off();
     static void send_dino_score(int score);
@@ -34,25 +42,62 @@ class CommandWebSocketManager : public Singleton<CommandWebSocketManager> {
     }
     static void set_is_user_connected_to_this_pip(bool new_is_user_connected_to_this_pip);
 
-    websockets::WebsocketsClient _wsClient; // Made public for binary message sending
+    // Smoothed WebSocket ping round trip on the command connection (0 until the first pong)
+    uint32_t get_rtt_ms() const {
+        return _rttMs;
+    }
+    ReconnectStats get_reconnect_stats() const {
+        return _reconnect.get_stats();
+    }
+    // Multiplexed mode only - the telemetry channel lives on this connection
+    uint8_t get_telemetry_downsample() const {
+        return _outbox.get_telemetry_downsample();
+    }
+    WsLinkStats get_link_stats() const {
+        return _outbox.get_link_stats();
+    }
+
+    // Poll period of the command WebSocket task; faster in multiplexed mode because telemetry rides this connection
+    static uint32_t get_poll_interval_ms() {
+        return USE_MULTIPLEXED_WEBSOCKET ? MUX_POLL_INTERVAL : COMMAND_POLL_INTERVAL;
+    }
 
   private:
     CommandWebSocketManager();
 
-    static void handle_binary_message(WebsocketsMessage message);
+    static void handle_websocket_message(const WebsocketsMessage& message);
+    static void handle_command_frames(const uint8_t* data, uint16_t length);
+    static void send_frame_ack(uint8_t sequence);
+    static void send_frame_nack(uint8_t expected_sequence, FrameParseResult reason);
     static void send_initial_data();
     static void add_battery_data_to_payload(JsonObject& payload);
 
+    static constexpr uint32_t COMMAND_POLL_INTERVAL = 40; // Poll every 40ms
+    static constexpr uint32_t MUX_POLL_INTERVAL = 5;      // Matches the dedicated sensor socket's rate
+    static constexpr uint8_t MAX_SENDS_PER_POLL = 16;
+
+    websockets::WebsocketsClient _wsClient;
+    WebSocketOutbox _outbox; // Only used in multiplexed mode
     uint32_t _lastPollTime = 0;
-    const uint32_t POLL_INTERVAL = 40; // Poll every 40ms
 
     bool _wsConnected = false;
-    uint32_t _lastConnectionAttempt = 0;
-    const uint32_t CONNECTION_INTERVAL = 3000; // 3 seconds between connection attempts
+    bool _wifiLost = true; // Until WiFi first connects, so the first attempt takes the fast path
+    ReconnectBackoff _reconnect;
+    void on_connection_lost();
 
     static void kill_wifi_processes();
     uint32_t _lastPingTime = 0;
     const uint32_t WS_TIMEOUT = 3000; // 3 seconds timeout
+
+    // RTT probing: we ping the server periodically and time its pong
+    static constexpr uint32_t RTT_PROBE_INTERVAL = 2000;
+    uint32_t _lastRttProbe = 0;
+    uint32_t _rttProbeSentAt = 0;
+    bool _rttProbePending = false;
+    uint32_t _rttMs = 0;
+    void probe_rtt(uint32_t current_time);
+    void record_pong();
     bool _hasKilledWiFiProcesses = false;
     bool _userConnectedToThisPip = false;
+    FrameSequenceTracker _rxSequence;
 };
@@ -0,0 +1,193 @@
+#include "deferred_log.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    constexpr const char* FORMAT_STRINGS[] = {
+#define DEFERRED_LOG_STRING_ENTRY(id, format) format,
+        DEFERRED_LOG_FORMATS(DEFERRED_LOG_STRING_ENTRY)
+#undef DEFERRED_LOG_STRING_ENTRY
+    };
+
+    constexpr size_t MAX_SPEC_LENGTH = 16;
+
+    bool is_conversion_char(char c) {
+        return strchr("diuxXocfFeEgGs%", c) != nullptr;
+    }
+
+    bool is_length_modifier(char c) {
+        return c == 'l' || c == 'h' || c == 'z' || c == 'j' || c == 't' || c == 'L';
+    }
+
+    // Formats a single argument with a single printf conversion. Length modifiers are stripped from
+    // the spec and the argument is passed as the type the stripped conversion expects (64-bit
+    // integers get an "ll" modifier put back in front of the conversion).
+    int format_arg(const char* spec, char conversion, const DeferredLogArg& arg, char* out, size_t out_size) {
+        float float_value = 0.0f;
+        const auto LOW_WORD = static_cast<uint32_t>(arg.bits);
+        memcpy(&float_value, &LOW_WORD, sizeof(float_value));
+        const bool IS_64_BIT = arg.type == LogArgType::INT64 || arg.type == LogArgType::UINT64;
+
+        char wide_spec[MAX_SPEC_LENGTH + 2];
+        if (IS_64_BIT) {
+            const size_t SPEC_LENGTH = strlen(spec);
+            memcpy(wide_spec, spec, SPEC_LENGTH - 1);
+            memcpy(wide_spec + SPEC_LENGTH - 1, "ll", 2);
+            wide_spec[SPEC_LENGTH + 1] = conversion;
+            wide_spec[SPEC_LENGTH + 2] = '\0';
+        }
+
+        switch (conversion) {
+            case 'd':
+            case 'i':
+                if (arg.type == LogArgType::FLOAT) {
+                    return snprintf(out, out_size, spec, static_cast<int>(float_value));
+                }
+                if (IS_64_BIT) {
+                    return snprintf(out, out_size, wide_spec, static_cast<long long>(arg.bits));
+                }
+                return snprintf(out, out_size, spec, static_cast<int>(LOW_WORD));
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'c':
+                if (arg.type == LogArgType::FLOAT) {
+                    return snprintf(out, out_size, spec, static_cast<unsigned>(float_value));
+                }
+                if (IS_64_BIT && conversion != 'c') {
+                    return snprintf(out, out_size, wide_spec, static_cast<unsigned long long>(arg.bits));
+                }
+                return snprintf(out, out_size, spec, static_cast<unsigned>(LOW_WORD));
+            case 's':
+                if (arg.type == LogArgType::STRING) {
+                    const char* value = reinterpret_cast<const char*>(static_cast<uintptr_t>(arg.bits));
+                    return snprintf(out, out_size, spec, value != nullptr ? value : "(null)");
+                }
+                return snprintf(out, out_size, spec, arg.bits != 0 ? "true" : "false");
+            default: // f F e E g G
+                if (arg.type == LogArgType::FLOAT) {
+                    return snprintf(out, out_size, spec, static_cast<double>(float_value));
+                }
+                if (arg.type == LogArgType::INT) {
+                    return snprintf(out, out_size, spec, static_cast<double>(static_cast<int32_t>(LOW_WORD)));
+                }
+                if (arg.type == LogArgType::INT64) {
+                    return snprintf(out, out_size, spec, static_cast<double>(static_cast<int64_t>(arg.bits)));
+                }
+                return snprintf(out, out_size, spec, static_cast<double>(arg.bits));
+        }
+    }
+} // namespace
+
+namespace deferred_log {
+    const char* get_format_string(LogFormat format) {
+        const auto INDEX = static_cast<uint16_t>(format);
+        if (INDEX >= static_cast<uint16_t>(LogFormat::COUNT)) {
+            return nullptr;
+        }
+        return FORMAT_STRINGS[INDEX];
+    }
+
+    size_t encode(LogFormat format, const DeferredLogArg* args, uint8_t arg_count, uint8_t* out) {
+        const auto FORMAT_ID = static_cast<uint16_t>(format);
+        out[0] = FORMAT_ID & 0xFF;
+        out[1] = FORMAT_ID >> 8;
+        out[2] = arg_count;
+
+        size_t offset = 3;
+        for (uint8_t i = 0; i < arg_count; i++) {
+            out[offset++] = static_cast<uint8_t>(args[i].type);
+        }
+        for (uint8_t i = 0; i < arg_count; i++) {
+            const size_t ARG_SIZE = encoded_arg_size(args[i].type);
+            if (ARG_SIZE == sizeof(uint32_t)) {
+                const auto LOW_WORD = static_cast<uint32_t>(args[i].bits);
+                memcpy(out + offset, &LOW_WORD, ARG_SIZE);
+            } else {
+                memcpy(out + offset, &args[i].bits, ARG_SIZE);
+            }
+            offset += ARG_SIZE;
+        }
+        return offset;
+    }
+
+    size_t format(const uint8_t* record, size_t record_length, char* out, size_t out_size) {
+        if (out_size == 0) {
+            return 0;
+        }
+        out[0] = '\0';
+        if (record_length < 3) {
+            return 0;
+        }
+
+        const auto FORMAT_ID = static_cast<uint16_t>(record[0] | (record[1] << 8));
+        const uint8_t ARG_COUNT = record[2];
+        const char* fmt = get_format_string(static_cast<LogFormat>(FORMAT_ID));
+        if (fmt == nullptr || ARG_COUNT > MAX_ARGS || record_length < 3 + ARG_COUNT) {
+            return snprintf(out, out_size, "<bad deferred log record %u>", FORMAT_ID);
+        }
+
+        DeferredLogArg args[MAX_ARGS];
+        size_t offset = 3 + ARG_COUNT;
+        for (uint8_t i = 0; i < ARG_COUNT; i++) {
+            args[i].type = static_cast<LogArgType>(record[3 + i]);
+            const size_t ARG_SIZE = encoded_arg_size(args[i].type);
+            if (offset + ARG_SIZE > record_length) {
+                return snprintf(out, out_size, "<bad deferred log record %u>", FORMAT_ID);
+            }
+            if (ARG_SIZE == sizeof(uint32_t)) {
+                uint32_t low_word = 0;
+                memcpy(&low_word, record + offset, ARG_SIZE);
+                args[i].bits = low_word;
+            } else {
+                memcpy(&args[i].bits, record + offset, ARG_SIZE);
+            }
+            offset += ARG_SIZE;
+        }
+
+        size_t written = 0;
+        uint8_t next_arg = 0;
+        while (*fmt != '\0' && written + 1 < out_size) {
+            if (*fmt != '%') {
+                out[written++] = *fmt++;
+                continue;
+            }
+
+            // Collect one conversion spec, dropping length modifiers
+            char spec[MAX_SPEC_LENGTH];
+            size_t spec_length = 0;
+            spec[spec_length++] = *fmt++;
+            while (*fmt != '\0' && !is_conversion_char(*fmt) && spec_length < MAX_SPEC_LENGTH - 2) {
+                if (!is_length_modifier(*fmt)) {
+                    spec[spec_length++] = *fmt;
+                }
+                fmt++;
+            }
+            if (*fmt == '\0') {
+                break;
+            }
+            const char CONVERSION = *fmt++;
+            spec[spec_length++] = CONVERSION;
+            spec[spec_length] = '\0';
+
+            if (CONVERSION == '%') {
+                out[written++] = '%';
+                continue;
+            }
+            if (next_arg >= ARG_COUNT) {
+                break; // Format expects more arguments than the producer supplied
+            }
+
+            const int RESULT = format_arg(spec, CONVERSION, args[next_arg++], out + written, out_size - written);
+            if (RESULT < 0) {
+                break;
+            }
+            written += std::min(static_cast<size_t>(RESULT), out_size - written - 1);
+        }
+
+        out[written] = '\0';
+        return written;
+    }
+} // namespace deferred_log
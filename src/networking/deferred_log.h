@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <cstdint>
+
+// Every deferred log line is declared here as X(ID, "format"). Producers only enqueue the numeric ID
+// plus raw argument words; the SerialQueue task expands the format string when it prints the record.
+// Append new entries at the end - the IDs are part of the binary record format.
+// Supported conversions: d i u x X c f e g s. %s takes a string literal (only the pointer is stored, so it must
+// outlive the record) or a bool, printed as true/false. 64-bit integers are kept whole.
+#define DEFERRED_LOG_FORMATS(X)                                                                      \
+    X(TURN_STARTED, "Starting turn: %.1f degrees")                                                   \
+    X(TURN_OVERSHOOT_BRAKING, "High-speed overshoot detected! Braking for %dms")                     \
+    X(TURN_APPROACHING_COMPLETION, "Approaching completion: Remaining=%.2f°, Vel=%.2f°/s")           \
+    X(TURN_COMPLETE, "Turn complete! Final error: %.2f°")                                            \
+    X(TURN_PREDICTIVE_TOO_FAST, "PREDICTIVE: Too fast! Time to target: %.1fms, Remaining: %.1f°, Vel: %.1f°/s") \
+    X(IMU_FREQUENCY, "IMU Frequency: %.1f Hz, Data Valid: %s, Yaw: %.1f, Pitch: %.1f, Roll: %.1f")  \
+    X(SIDE_TOF_COUNTS, "Left TOF: %u counts              || Right TOF: %u counts")                   \
+    X(MULTIZONE_TOF_FREQUENCY, "Multizone ToF Frequency: %.1f Hz, Data Valid: %s, Object Detected: %s") \
+    X(SIDE_TOF_FREQUENCY, "Side ToF Frequency: %.1f Hz, Left: %u, Right: %u")                        \
+    X(COLOR_SENSOR_FREQUENCY, "Color Sensor Frequency: %.1f Hz, RGB: (%u,%u,%u)")                   \
+    X(MOTOR_RPM, "Motor RPM - Left: %.2f || Right: %.2f")                                           \
+    X(DISPLAY_PERFORMANCE, "DISPLAY: %.2f Hz actual I2C (Generated: %lu, Updates: %lu, Skipped: %lu)") \
+    X(BUTTON_LONG_PRESS_LEFT, "Left Button long pressed for %u ms")                                  \
+    X(BUTTON_LONG_PRESS_RIGHT, "Right Button long pressed for %u ms")                                \
+    X(IMU_UPDATE_FREQUENCY_DEBUG, "DEBUG: updateDelta=%u, timeDelta=%u, freq=%.1f")                  \
+    X(VM_UNKNOWN_SENSOR_TYPE, "Unknown sensor type: %u")                                           \
+    X(ACTUATOR_SUPERSEDED, "Superseded actuator commands - Motor: %lu, LEDs: %lu, Headlights: %lu, Display: %lu") \
+    X(WS_LINK_STATS, "WS link - RTT: %lu ms, Send: %lu us, Throughput: %lu B/s, Telemetry shed: %lu, Rate: 1/%u") \
+    X(SENSOR_INIT_TIMING, "Sensor init timing - Multizone TOF: %lu ms (ok: %s), IMU: %lu ms (ok: %s), Color: %lu ms (ok: %s)")
+
+enum class LogFormat : uint16_t {
+#define DEFERRED_LOG_ENUM_ENTRY(id, format) id,
+    DEFERRED_LOG_FORMATS(DEFERRED_LOG_ENUM_ENTRY)
+#undef DEFERRED_LOG_ENUM_ENTRY
+        COUNT
+};
+
+enum class LogArgType : uint8_t { INT = 0, UINT = 1, FLOAT = 2, BOOL = 3, INT64 = 4, UINT64 = 5, STRING = 6 };
+
+// One raw argument word plus its type tag. Implicit constructors let call sites pass ordinary numeric
+// values and string literals; the conversion is a register move, no formatting happens here.
+struct DeferredLogArg {
+    LogArgType type{LogArgType::UINT};
+    uint64_t bits{0}; // 32-bit types use the low word
+
+    DeferredLogArg() = default;
+    DeferredLogArg(int value) : type(LogArgType::INT), bits(static_cast<uint32_t>(value)) {}
+    DeferredLogArg(long value) : type(LogArgType::INT), bits(static_cast<uint32_t>(value)) {}
+    DeferredLogArg(long long value) : type(LogArgType::INT64), bits(static_cast<uint64_t>(value)) {}
+    DeferredLogArg(unsigned int value) : type(LogArgType::UINT), bits(value) {}
+    DeferredLogArg(unsigned long value) : type(LogArgType::UINT), bits(static_cast<uint32_t>(value)) {}
+    DeferredLogArg(unsigned long long value) : type(LogArgType::UINT64), bits(value) {}
+    DeferredLogArg(bool value) : type(LogArgType::BOOL), bits(value ? 1 : 0) {}
+    DeferredLogArg(const char* value) : type(LogArgType::STRING), bits(reinterpret_cast<uintptr_t>(value)) {}
+    DeferredLogArg(float value) : type(LogArgType::FLOAT) {
+        uint32_t raw = 0;
+        memcpy(&raw, &value, sizeof(raw));
+        bits = raw;
+    }
+    DeferredLogArg(double value) : DeferredLogArg(static_cast<float>(value)) {}
+};
+
+namespace deferred_log {
+    constexpr uint8_t MAX_ARGS = 6;
+
+    // Encoded record: format ID (2 bytes), arg count (1), one type tag per arg, then 4 bytes per arg
+    // (8 for 64-bit integers and string pointers)
+    constexpr size_t MAX_ENCODED_SIZE = 3 + MAX_ARGS * (1 + sizeof(uint64_t));
+
+    inline size_t encoded_arg_size(LogArgType type) {
+        return (type == LogArgType::INT64 || type == LogArgType::UINT64 || type == LogArgType::STRING) ? sizeof(uint64_t)
+                                                                                                         : sizeof(uint32_t);
+    }
+
+    size_t encode(LogFormat format, const DeferredLogArg* args, uint8_t arg_count, uint8_t* out);
+
+    // Expands an encoded record into text. Returns the number of characters written (excluding the terminator)
+    size_t format(const uint8_t* record, size_t record_length, char* out, size_t out_size);
+
+    const char* get_format_string(LogFormat format);
+} // namespace deferred_log
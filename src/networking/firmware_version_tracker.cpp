@@ -15,6 +15,8 @@ FirmwareVersionTracker::FirmwareVersionTracker() {
     // Set onEnd callback to update firmware version before reboot
     _http_update.onEnd([this]() { PreferencesManager::get_instance().set_firmware_version(this->_pending_version); });
 
+    _streaming_ota.on_progress([this](int curr, int total) { this->update_progress_leds(curr, total); });
+
     // Setup clients based on environment
     if (DEFAULT_ENVIRONMENT == "local") {
         _http_client = &_insecure_client;
@@ -46,10 +48,30 @@ void FirmwareVersionTracker::retrieve_latest_firmware_from_server(uint16_t new_v
     instance._pending_version = new_version; // Store for the callback to use
     instance._is_retrieving_firmware_from_server = true;
 
-    // Get endpoint
-    String url = get_server_firmware_endpoint();
     career_quest_triggers.stop_all_career_quest_triggers(true); // Stop all sensors, movement when updating
 
+    // Smallest download first: a delta against the running firmware, then the compressed full image, then the plain
+    // binary. Progress is keyed by the target image, so blocks committed by one streaming image carry over to the other
+    const String DELTA_URL = String(get_server_delta_firmware_endpoint()) + "?from=" + String(instance._firmware_version) +
+                             "&to=" + String(new_version);
+    OtaResult streaming_result = instance._streaming_ota.update(*instance._http_client, DELTA_URL, new_version);
+    if (streaming_result == OtaResult::NOT_AVAILABLE || streaming_result == OtaResult::FAILED) {
+        streaming_result = instance._streaming_ota.update(*instance._http_client, get_server_compressed_firmware_endpoint(), new_version);
+    }
+    if (streaming_result == OtaResult::OK) {
+        PreferencesManager::get_instance().set_firmware_version(new_version);
+        SerialQueueManager::get_instance().queue_message("Firmware update complete, restarting...");
+        vTaskDelay(pdMS_TO_TICKS(100)); // Let the serial queue flush
+        ESP.restart();
+    }
+    if (streaming_result == OtaResult::INTERRUPTED) {
+        instance._is_retrieving_firmware_from_server = false;
+        return; // Resumes from the last committed block on the next update request
+    }
+    instance._http_client->stop(); // Drop the kept-alive range connection before the full download
+
+    String url = get_server_firmware_endpoint();
+
     // Perform the update
     t_httpUpdate_return result = instance._http_update.update(*instance._http_client, url);
 
@@ -7,6 +7,7 @@
 #include "actuators/led/rgb_led.h"
 #include "career_quest/career_quest_triggers.h"
 #include "networking/serial_queue_manager.h"
+#include "networking/streaming_ota.h"
 #include "sensors/sensor_data_buffer.h"
 #include "utils/config.h"
 #include "utils/preferences_manager.h"
@@ -30,6 +31,7 @@ class FirmwareVersionTracker : public Singleton<FirmwareVersionTracker> {
     WiFiClientSecure _secure_client;
     WiFiClient _insecure_client;
 
-    HTTPUpdate _http_update;
+    HTTPUpdate _http_update; // Full uncompressed download, used when the server has no compressed image
+    StreamingOta _streaming_ota;
     static void update_progress_leds(int progress, int total);
 };
@@ -0,0 +1,155 @@
+#include "frame_parser.h"
+
+#include <cstring>
+
+#include "utils/config.h"
+
+FrameParseResult FrameParser::parse(const uint8_t* data, uint16_t available, ParsedFrame& frame) {
+    if (available == 0) {
+        return FrameParseResult::INCOMPLETE;
+    }
+    if (data[0] == START_MARKER_V2) {
+        return parse_v2(data, available, frame);
+    }
+    return parse_v1(data, available, frame);
+}
+
+FrameParseResult FrameParser::parse_v1(const uint8_t* data, uint16_t available, ParsedFrame& frame) {
+    if (available < V1_SHORT_HEADER_SIZE) {
+        return FrameParseResult::INCOMPLETE;
+    }
+
+    const bool USE_LONG_FORMAT = (data[2] != 0);
+    const uint16_t HEADER_SIZE = USE_LONG_FORMAT ? V1_LONG_HEADER_SIZE : V1_SHORT_HEADER_SIZE;
+    if (available < HEADER_SIZE) {
+        return FrameParseResult::INCOMPLETE;
+    }
+
+    const uint16_t PAYLOAD_LENGTH = USE_LONG_FORMAT ? (data[3] | (data[4] << 8)) : data[3];
+    if (PAYLOAD_LENGTH > MAX_PROGRAM_SIZE) {
+        return FrameParseResult::BAD_LENGTH;
+    }
+
+    const uint16_t FRAME_SIZE = HEADER_SIZE + PAYLOAD_LENGTH + 1; // +1 for end marker
+    if (available < FRAME_SIZE) {
+        return FrameParseResult::INCOMPLETE;
+    }
+    if (data[FRAME_SIZE - 1] != END_MARKER) {
+        return FrameParseResult::BAD_END_MARKER;
+    }
+
+    frame.messageType = data[1];
+    frame.payload = data + HEADER_SIZE;
+    frame.payloadLength = PAYLOAD_LENGTH;
+    frame.frameSize = FRAME_SIZE;
+    frame.isV2 = false;
+    frame.sequence = 0;
+    return FrameParseResult::COMPLETE;
+}
+
+FrameParseResult FrameParser::parse_v2(const uint8_t* data, uint16_t available, ParsedFrame& frame) {
+    if (available < V2_HEADER_SIZE) {
+        return FrameParseResult::INCOMPLETE;
+    }
+
+    // Sequence is reported even for rejected frames so callers can log it; it is only trusted once the CRC passes
+    frame.sequence = data[1];
+    frame.isV2 = true;
+
+    const uint16_t PAYLOAD_LENGTH = data[3] | (data[4] << 8);
+    if (PAYLOAD_LENGTH > MAX_PROGRAM_SIZE) {
+        return FrameParseResult::BAD_LENGTH;
+    }
+
+    const uint16_t FRAME_SIZE = V2_HEADER_SIZE + PAYLOAD_LENGTH + V2_CRC_SIZE + 1; // +1 for end marker
+    if (available < FRAME_SIZE) {
+        return FrameParseResult::INCOMPLETE;
+    }
+
+    const uint8_t* crc_bytes = data + V2_HEADER_SIZE + PAYLOAD_LENGTH;
+    const auto RECEIVED_CRC = static_cast<uint16_t>(crc_bytes[0] | (crc_bytes[1] << 8));
+    if (crc16(data + 1, V2_HEADER_SIZE - 1 + PAYLOAD_LENGTH) != RECEIVED_CRC) {
+        return FrameParseResult::BAD_CRC;
+    }
+    if (data[FRAME_SIZE - 1] != END_MARKER) {
+        return FrameParseResult::BAD_END_MARKER;
+    }
+
+    frame.messageType = data[2];
+    frame.payload = data + V2_HEADER_SIZE;
+    frame.payloadLength = PAYLOAD_LENGTH;
+    frame.frameSize = FRAME_SIZE;
+    return FrameParseResult::COMPLETE;
+}
+
+const uint8_t* FrameParser::find_start(const uint8_t* data, uint16_t length) {
+    const auto* v1_start = static_cast<const uint8_t*>(memchr(data, START_MARKER, length));
+    const uint16_t V2_SEARCH_LENGTH = (v1_start != nullptr) ? v1_start - data : length;
+    const auto* v2_start = static_cast<const uint8_t*>(memchr(data, START_MARKER_V2, V2_SEARCH_LENGTH));
+    return (v2_start != nullptr) ? v2_start : v1_start;
+}
+
+uint16_t FrameParser::crc16(const uint8_t* data, size_t length, uint16_t crc) {
+    // CRC-16/CCITT-FALSE: poly 0x1021, init 0xFFFF, no reflection, no final XOR
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) != 0 ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+const char* FrameParser::result_to_string(FrameParseResult result) {
+    switch (result) {
+        case FrameParseResult::COMPLETE:
+            return "ok";
+        case FrameParseResult::INCOMPLETE:
+            return "incomplete";
+        case FrameParseResult::BAD_LENGTH:
+            return "length";
+        case FrameParseResult::BAD_END_MARKER:
+            return "end-marker";
+        case FrameParseResult::BAD_CRC:
+            return "crc";
+        default:
+            return "";
+    }
+}
+
+bool FrameSequenceTracker::accept(uint8_t sequence) {
+    if (!_hasHighest) {
+        _hasHighest = true;
+        _highest = sequence;
+        _window = 1;
+        return true;
+    }
+
+    const auto AHEAD = static_cast<uint8_t>(sequence - _highest);
+    if (AHEAD == 0) {
+        return false;
+    }
+
+    if (AHEAD < 128) {
+        // Newer than anything seen: slide the window forward
+        _window = (AHEAD >= WINDOW_SIZE) ? 0 : (_window << AHEAD);
+        _window |= 1;
+        _highest = sequence;
+        return true;
+    }
+
+    const auto BEHIND = static_cast<uint8_t>(_highest - sequence);
+    if (BEHIND >= WINDOW_SIZE) {
+        // Far outside the window - the host restarted its sequence, follow it
+        _highest = sequence;
+        _window = 1;
+        return true;
+    }
+
+    const uint32_t BIT = 1UL << BEHIND;
+    if ((_window & BIT) != 0) {
+        return false;
+    }
+    _window |= BIT;
+    return true;
+}
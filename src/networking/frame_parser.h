@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "networking/protocol.h"
+
+// Shared framing for the serial link and the command WebSocket.
+//
+// v1: START_MARKER, type, format flag, length (1 byte, or 2 bytes LE when the flag is non-zero), payload, END_MARKER
+// v2: START_MARKER_V2, sequence, type, length (2 bytes LE), payload, CRC-16 (2 bytes LE), END_MARKER
+//     The CRC (CRC-16/CCITT-FALSE) covers sequence through the last payload byte. Every v2 frame is ACKed
+//     (or NACKed on a CRC/length error) so the host can pipeline frames and retransmit selectively.
+
+enum class FrameParseResult : uint8_t {
+    COMPLETE,       // A full, valid frame is available
+    INCOMPLETE,     // Need more bytes
+    BAD_LENGTH,     // Declared payload length exceeds MAX_PROGRAM_SIZE
+    BAD_END_MARKER, // Byte after the payload (and CRC) is not END_MARKER
+    BAD_CRC         // v2 only: checksum mismatch
+};
+
+struct ParsedFrame {
+    uint8_t messageType = 0;
+    const uint8_t* payload = nullptr; // Points into the caller's buffer
+    uint16_t payloadLength = 0;
+    uint16_t frameSize = 0; // Total bytes the frame occupies, markers included
+    bool isV2 = false;
+    uint8_t sequence = 0; // v2 only
+};
+
+class FrameParser {
+  public:
+    // Parses one frame from data, which must start with START_MARKER or START_MARKER_V2
+    static FrameParseResult parse(const uint8_t* data, uint16_t available, ParsedFrame& frame);
+
+    // Returns the first START_MARKER or START_MARKER_V2 in [data, data + length), or nullptr
+    static const uint8_t* find_start(const uint8_t* data, uint16_t length);
+
+    static uint16_t crc16(const uint8_t* data, size_t length, uint16_t crc = 0xFFFF);
+
+    // Short reason string for NACKs and logs
+    static const char* result_to_string(FrameParseResult result);
+
+  private:
+    static constexpr uint16_t V1_SHORT_HEADER_SIZE = 4;
+    static constexpr uint16_t V1_LONG_HEADER_SIZE = 5;
+    static constexpr uint16_t V2_HEADER_SIZE = 5;
+    static constexpr uint16_t V2_CRC_SIZE = 2;
+
+    static FrameParseResult parse_v1(const uint8_t* data, uint16_t available, ParsedFrame& frame);
+    static FrameParseResult parse_v2(const uint8_t* data, uint16_t available, ParsedFrame& frame);
+};
+
+// Remembers which v2 sequence numbers were processed recently so a retransmitted frame whose ACK was
+// lost is re-ACKed without being executed twice. One instance per transport; reset on (re)connect.
+class FrameSequenceTracker {
+  public:
+    void reset() {
+        _hasHighest = false;
+        _window = 0;
+    }
+
+    // Returns false if the sequence number is a duplicate of one processed within the window
+    bool accept(uint8_t sequence);
+
+    uint8_t next_expected() const {
+        return _hasHighest ? static_cast<uint8_t>(_highest + 1) : 0;
+    }
+
+  private:
+    static constexpr uint8_t WINDOW_SIZE = 32;
+
+    bool _hasHighest = false;
+    uint8_t _highest = 0;
+    uint32_t _window = 0; // Bit i set => (_highest - i) was processed
+};
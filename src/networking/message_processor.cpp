@@ -2,17 +2,25 @@
 
 #include <math.h>
 
+#include <algorithm>
 #include <cmath>
 
-void MessageProcessor::handle_motor_control(const uint8_t* data) {
+#include "career_quest/career_trigger_table.h"
+
+void MessageProcessor::handle_motor_control(const uint8_t* payload, uint16_t length) {
+    (void)length;
     // Extract 16-bit signed integers (little-endian)
-    auto left_speed = static_cast<int16_t>(data[1] | (data[2] << 8));
-    auto right_speed = static_cast<int16_t>(data[3] | (data[4] << 8));
+    auto left_speed = static_cast<int16_t>(payload[0] | (payload[1] << 8));
+    auto right_speed = static_cast<int16_t>(payload[2] | (payload[3] << 8));
 
-    motor_driver.update_motor_pwm(left_speed, right_speed);
+    // Applied by the motor task; a newer joystick sample replaces one it has not picked up yet
+    ActuatorMailbox::get_instance().post_motor_pwm(left_speed, right_speed);
 }
 
-void MessageProcessor::handle_balance_command(BalanceStatus status) {
+void MessageProcessor::handle_balance_command(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    auto status = static_cast<BalanceStatus>(payload[0]);
+    ActuatorMailbox::get_instance().discard_pending_motor_command(); // The demo (or its stop) owns the motors from here
     if (status == BalanceStatus::BALANCED) {
         DemoManager::get_instance().start_demo(demo::DemoType::BALANCE_CONTROLLER);
         return;
@@ -23,7 +31,10 @@ void MessageProcessor::handle_balance_command(BalanceStatus status) {
     }
 }
 
-void MessageProcessor::handle_obstacle_avoidance_command(ObstacleAvoidanceStatus status) {
+void MessageProcessor::handle_obstacle_avoidance_command(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    auto status = static_cast<ObstacleAvoidanceStatus>(payload[0]);
+    ActuatorMailbox::get_instance().discard_pending_motor_command(); // The demo (or its stop) owns the motors from here
     if (status == ObstacleAvoidanceStatus::AVOID) {
         DemoManager::get_instance().start_demo(demo::DemoType::OBSTACLE_AVOIDER);
         return;
@@ -34,7 +45,10 @@ void MessageProcessor::handle_obstacle_avoidance_command(ObstacleAvoidanceStatus
     }
 }
 
-void MessageProcessor::handle_light_command(LightAnimationStatus light_animation_status) {
+void MessageProcessor::handle_light_command(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    auto light_animation_status = static_cast<LightAnimationStatus>(payload[0]);
+    ActuatorMailbox::get_instance().discard_pending_led_colors(); // A queued color frame must not land after this
     if (light_animation_status == LightAnimationStatus::NO_ANIMATION) {
         led_animations.stop_animation();
     } else if (light_animation_status == LightAnimationStatus::BREATHING) {
@@ -50,42 +64,17 @@ void MessageProcessor::handle_light_command(LightAnimationStatus light_animation
     }
 }
 
-void MessageProcessor::handle_new_light_colors(NewLightColors new_light_colors) {
-    // Cast from float to uint8_t, assuming values are already in 0-255 range
-    auto top_left_r = new_light_colors.topLeftRed;
-    auto top_left_g = new_light_colors.topLeftGreen;
-    auto top_left_b = new_light_colors.topLeftBlue;
-
-    auto top_right_r = new_light_colors.topRightRed;
-    auto top_right_g = new_light_colors.topRightGreen;
-    auto top_right_b = new_light_colors.topRightBlue;
-
-    auto middle_left_r = new_light_colors.middleLeftRed;
-    auto middle_left_g = new_light_colors.middleLeftGreen;
-    auto middle_left_b = new_light_colors.middleLeftBlue;
-
-    auto middle_right_r = new_light_colors.middleRightRed;
-    auto middle_right_g = new_light_colors.middleRightGreen;
-    auto middle_right_b = new_light_colors.middleRightBlue;
-
-    auto back_left_r = new_light_colors.backLeftRed;
-    auto back_left_g = new_light_colors.backLeftGreen;
-    auto back_left_b = new_light_colors.backLeftBlue;
-
-    auto back_right_r = new_light_colors.backRightRed;
-    auto back_right_g = new_light_colors.backRightGreen;
-    auto back_right_b = new_light_colors.backRightBlue;
-
-    // Set each LED to its corresponding color
-    rgb_led.set_top_left_led(top_left_r, top_left_g, top_left_b);
-    rgb_led.set_top_right_led(top_right_r, top_right_g, top_right_b);
-    rgb_led.set_middle_left_led(middle_left_r, middle_left_g, middle_left_b);
-    rgb_led.set_middle_right_led(middle_right_r, middle_right_g, middle_right_b);
-    rgb_led.set_back_left_led(back_left_r, back_left_g, back_left_b);
-    rgb_led.set_back_right_led(back_right_r, back_right_g, back_right_b);
+void MessageProcessor::handle_new_light_colors(const uint8_t* payload, uint16_t length) {
+    // Only the six body LEDs (18 bytes) are sent; the headlight fields stay zeroed
+    NewLightColors new_light_colors{};
+    memcpy(&new_light_colors, payload, std::min<size_t>(length, sizeof(NewLightColors)));
+
+    ActuatorMailbox::get_instance().post_led_colors(new_light_colors);
 }
 
-void MessageProcessor::handle_get_saved_wifi_networks() {
+void MessageProcessor::handle_get_saved_wifi_networks(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
     // Get saved networks from WiFiManager
     std::vector<WiFiCredentials> saved_networks = WiFiManager::get_instance().get_saved_networks_for_response();
 
@@ -93,7 +82,9 @@ void MessageProcessor::handle_get_saved_wifi_networks() {
     SerialManager::get_instance().send_saved_networks_response(saved_networks);
 }
 
-void MessageProcessor::handle_soft_scan_wifi_networks() {
+void MessageProcessor::handle_soft_scan_wifi_networks(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
     // Check if we have recent scan results (within 1 minute)
     WiFiManager& wifi_manager = WiFiManager::get_instance();
     if (wifi_manager.has_available_networks()) {
@@ -116,7 +107,9 @@ void MessageProcessor::handle_soft_scan_wifi_networks() {
     SerialManager::get_instance().send_scan_results_response(empty_networks);
 }
 
-void MessageProcessor::handle_hard_scan_wifi_networks() {
+void MessageProcessor::handle_hard_scan_wifi_networks(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
     bool success = WiFiManager::get_instance().start_async_scan();
     if (success) {
         return;
@@ -126,508 +119,212 @@ void MessageProcessor::handle_hard_scan_wifi_networks() {
     SerialManager::get_instance().send_scan_results_response(empty_networks);
 }
 
-void MessageProcessor::process_binary_message(const uint8_t* data, uint16_t length) {
-    TimeoutManager::get_instance().reset_activity();
+void MessageProcessor::handle_update_available(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    // Extract the firmware version (little-endian)
+    const uint16_t NEW_VERSION = payload[0] | (payload[1] << 8);
+    FirmwareVersionTracker::get_instance().retrieve_latest_firmware_from_server(NEW_VERSION);
+}
+
+void MessageProcessor::handle_tone_command(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    Speaker::get_instance().play_tone(static_cast<ToneType>(payload[0]));
+}
+
+void MessageProcessor::handle_speaker_mute(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    Speaker::get_instance().set_muted(static_cast<SpeakerStatus>(payload[0]) == SpeakerStatus::MUTED);
+}
+
+void MessageProcessor::handle_update_balance_pids(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    NewBalancePids new_balance_pids{};
+    memcpy(&new_balance_pids, payload, sizeof(NewBalancePids));
+    BalanceController::get_instance().update_balance_pids(new_balance_pids);
+}
+
+void MessageProcessor::handle_bytecode_program(const uint8_t* payload, uint16_t length) {
+    BytecodeVM::get_instance().load_program(payload, length);
+}
+
+void MessageProcessor::handle_stop_sandbox_code(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    BytecodeVM::get_instance().stop_program();
+}
+
+void MessageProcessor::handle_stop_sensor_polling(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    SensorDataBuffer::get_instance().stop_polling_all_sensors();
+}
+
+void MessageProcessor::handle_serial_handshake(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    SerialManager::get_instance()._isConnected = true;
+    SerialManager::get_instance().last_activity_time = millis();
+    SerialManager::get_instance().send_pip_id_message();
+
+    // Send initial battery data on handshake
+    const BatteryState& battery_state = BatteryMonitor::get_instance().get_battery_state();
+    if (battery_state.isInitialized) {
+        SerialManager::get_instance().send_battery_monitor_data();
+        BatteryMonitor::get_instance()._lastBatteryLogTime = millis();
+    }
+}
+
+void MessageProcessor::handle_serial_keepalive(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    SerialManager::get_instance().last_activity_time = millis();
+}
+
+void MessageProcessor::handle_serial_end(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    ActuatorMailbox::get_instance().discard_pending_led_commands();
+    rgb_led.turn_all_leds_off();
+    SerialManager::get_instance()._isConnected = false;
+    SensorDataBuffer::get_instance().stop_polling_all_sensors();
+    Speaker::get_instance().stop_all_sounds();
+}
+
+void MessageProcessor::handle_update_headlights(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    ActuatorMailbox::get_instance().post_headlights(static_cast<HeadlightStatus>(payload[0]));
+}
+
+void MessageProcessor::handle_wifi_credentials(const uint8_t* payload, uint16_t length) {
+    const uint8_t SSID_LENGTH = payload[0];
+    if (SSID_LENGTH == 0 || 1 + SSID_LENGTH >= length) {
+        SerialQueueManager::get_instance().queue_message("Invalid SSID length");
+        return;
+    }
+
+    const uint8_t PASSWORD_LENGTH = payload[1 + SSID_LENGTH];
+    if (1 + SSID_LENGTH + 1 + PASSWORD_LENGTH != length) {
+        SerialQueueManager::get_instance().queue_message("Invalid password length");
+        return;
+    }
+
+    String ssid = "";
+    ssid.concat(reinterpret_cast<const char*>(payload + 1), SSID_LENGTH);
+    String password = "";
+    password.concat(reinterpret_cast<const char*>(payload + 2 + SSID_LENGTH), PASSWORD_LENGTH);
+
+    // Test WiFi credentials before storing permanently
+    WiFiManager::get_instance().start_wifi_credential_test(ssid, password);
+}
+
+void MessageProcessor::handle_ignored(const uint8_t* payload, uint16_t length) {
+    // Message types the robot sends but never receives (e.g. WIFI_CONNECTION_RESULT)
+    (void)payload;
+    (void)length;
+}
+
+void MessageProcessor::handle_speaker_volume(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    // Extract the 4-byte float32 value (little-endian)
+    float volume = NAN;
+    memcpy(&volume, payload, sizeof(float));
+    Speaker::get_instance().set_volume(volume);
+}
+
+void MessageProcessor::handle_stop_tone(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    Speaker::get_instance().stop_all_sounds();
+}
+
+void MessageProcessor::handle_update_display(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    ActuatorMailbox::get_instance().post_display_buffer(payload);
+}
+
+void MessageProcessor::handle_trigger_message(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    ActuatorMailbox::get_instance().discard_all_pending(); // Triggers drive LEDs, display and motors directly
+    career_trigger_table::dispatch(static_cast<CareerType>(payload[0]), payload[1]);
+}
+
+void MessageProcessor::handle_stop_career_quest_trigger(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    ActuatorMailbox::get_instance().discard_all_pending();
+    career_quest_triggers.stop_all_career_quest_triggers(true);
+}
+
+void MessageProcessor::handle_show_display_start_screen(const uint8_t* payload, uint16_t length) {
+    (void)payload;
+    (void)length;
+    ActuatorMailbox::get_instance().discard_pending_display_buffer();
+    DisplayScreen::get_instance().show_start_screen();
+}
+
+void MessageProcessor::handle_is_user_connected_to_pip(const uint8_t* payload, uint16_t length) {
+    (void)length;
+    if (static_cast<UserConnectedStatus>(payload[0]) == UserConnectedStatus::NOT_CONNECTED) {
+        CommandWebSocketManager::get_instance().set_is_user_connected_to_this_pip(false);
+        return;
+    }
+    CommandWebSocketManager::get_instance().set_is_user_connected_to_this_pip(true);
+    BatteryMonitor::get_instance().send_battery_monitor_data_over_websocket();
+}
+
+void MessageProcessor::handle_forget_network(const uint8_t* payload, uint16_t length) {
+    // Length is validated here rather than in the table because failures must also be reported to the browser
     if (length < 1) {
-        SerialQueueManager::get_instance().queue_message("Binary message too short");
+        SerialQueueManager::get_instance().queue_message("Invalid forget network message length");
+        SerialManager::get_instance().send_network_deleted_response(false);
         return;
     }
-    // Extract the message type from the first byte
-    auto message_type = static_cast<DataMessageType>(data[0]);
-
-    switch (message_type) {
-        case DataMessageType::UPDATE_AVAILABLE: {
-            if (length != 3) {
-                SerialQueueManager::get_instance().queue_message("Invalid update available message length");
-            } else {
-                // Extract the firmware version from bytes 1-2
-                uint16_t new_version = data[1] | (data[2] << 8); // Little-endian conversion
-
-                // SerialQueueManager::get_instance().queue_message("New firmware version available: %d\n", new_version);
-                FirmwareVersionTracker::get_instance().retrieve_latest_firmware_from_server(new_version);
-            }
-            break;
-        }
-        case DataMessageType::MOTOR_CONTROL: {
-            if (length != 5) {
-                SerialQueueManager::get_instance().queue_message("Invalid motor control message length");
-            } else {
-                handle_motor_control(data);
-            }
-            break;
-        }
-        case DataMessageType::TONE_COMMAND: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid sound command message length");
-            } else {
-                auto tone_type = static_cast<ToneType>(data[1]);
-                Speaker::get_instance().play_tone(tone_type);
-            }
-            break;
-        }
-        case DataMessageType::SPEAKER_MUTE: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid speaker mute message length");
-            } else {
-                auto status = static_cast<SpeakerStatus>(data[1]);
-                Speaker::get_instance().set_muted(status == SpeakerStatus::MUTED);
-            }
-            break;
-        }
-        case DataMessageType::BALANCE_CONTROL: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid balance control message length");
-            } else {
-                auto status = static_cast<BalanceStatus>(data[1]);
-                handle_balance_command(status);
-            }
-            break;
-        }
-        case DataMessageType::UPDATE_LIGHT_ANIMATION: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid light animation message length");
-            } else {
-                auto light_animation_status = static_cast<LightAnimationStatus>(data[1]);
-                handle_light_command(light_animation_status);
-            }
-            break;
-        }
-        case DataMessageType::UPDATE_LED_COLORS: {
-            if (length != 19) {
-                // SerialQueueManager::get_instance().queue_message("Invalid update led colors message length%d", length);
-            } else {
-                NewLightColors new_light_colors;
-                memcpy(&new_light_colors, &data[1], sizeof(NewLightColors));
-                handle_new_light_colors(new_light_colors);
-            }
-            break;
-        }
-        case DataMessageType::UPDATE_BALANCE_PIDS: {
-            if (length != 41) { // 1 byte for type + 40 bytes for the struct (10 floats × 4 bytes)
-                SerialQueueManager::get_instance().queue_message("Invalid update balance pids message length");
-            } else {
-                NewBalancePids new_balance_pids{};
-                memcpy(&new_balance_pids, &data[1], sizeof(NewBalancePids));
-                BalanceController::get_instance().update_balance_pids(new_balance_pids);
-            }
-            break;
-        }
-        case DataMessageType::BYTECODE_PROGRAM: {
-            // First byte is the message type, the rest is bytecode
-            const uint8_t* bytecode_data = data + 1;
-            uint16_t bytecode_length = length - 1;
-
-            // Execute the bytecode
-            BytecodeVM::get_instance().load_program(bytecode_data, bytecode_length);
-            break;
-        }
-        case DataMessageType::STOP_SANDBOX_CODE: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid stop sandbox code message length");
-            } else {
-                BytecodeVM::get_instance().stop_program();
-            }
-            break;
-        }
 
-        case DataMessageType::STOP_SENSOR_POLLING: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid stop sandbox code message length");
-            } else {
-                SensorDataBuffer::get_instance().stop_polling_all_sensors();
-            }
-            break;
-        }
+    const uint8_t SSID_LENGTH = payload[0];
+    if (SSID_LENGTH == 0 || 1 + SSID_LENGTH != length) {
+        SerialQueueManager::get_instance().queue_message("Invalid SSID length in forget network message");
+        SerialManager::get_instance().send_network_deleted_response(false);
+        return;
+    }
 
-        case DataMessageType::OBSTACLE_AVOIDANCE: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid obstacle avoidance command");
-            } else {
-                auto status = static_cast<ObstacleAvoidanceStatus>(data[1]);
-                handle_obstacle_avoidance_command(status);
-            }
-            break;
-        }
-        case DataMessageType::SERIAL_HANDSHAKE: {
-            SerialManager::get_instance()._isConnected = true;
-            SerialManager::get_instance().last_activity_time = millis();
-            SerialManager::get_instance().send_pip_id_message();
-
-            // Send initial battery data on handshake
-            const BatteryState& battery_state = BatteryMonitor::get_instance().get_battery_state();
-            if (battery_state.isInitialized) {
-                SerialManager::get_instance().send_battery_monitor_data();
-                BatteryMonitor::get_instance()._lastBatteryLogTime = millis();
-            }
-            break;
-        }
-        case DataMessageType::SERIAL_KEEPALIVE: {
-            SerialManager::get_instance().last_activity_time = millis();
-            break;
-        }
-        case DataMessageType::SERIAL_END: {
-            rgb_led.turn_all_leds_off();
-            SerialManager::get_instance()._isConnected = false;
-            SensorDataBuffer::get_instance().stop_polling_all_sensors();
-            Speaker::get_instance().stop_all_sounds();
-            break;
-        }
-        case DataMessageType::UPDATE_HEADLIGHTS: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid update headlights message length");
-            } else {
-                auto status = static_cast<HeadlightStatus>(data[1]);
-                if (status == HeadlightStatus::ON) {
-                    rgb_led.turn_headlights_on();
-                } else {
-                    rgb_led.turn_headlights_off();
-                }
-            }
-            break;
-        }
-        case DataMessageType::WIFI_CREDENTIALS: {
-            if (length < 3) { // At least 1 byte for each length field + message type
-                SerialQueueManager::get_instance().queue_message("Invalid WiFi credentials message length");
-                break;
-            }
-
-            const uint8_t SSID_LENGTH = data[1];
-            if (SSID_LENGTH == 0 || 2 + SSID_LENGTH >= length) {
-                SerialQueueManager::get_instance().queue_message("Invalid SSID length");
-                break;
-            }
-
-            String ssid = "";
-            for (uint8_t i = 0; i < SSID_LENGTH; i++) {
-                ssid += static_cast<char>(data[2 + i]);
-            }
-
-            const uint8_t PASSWORD_LENGTH = data[2 + SSID_LENGTH];
-            if (2 + SSID_LENGTH + 1 + PASSWORD_LENGTH != length) {
-                SerialQueueManager::get_instance().queue_message("Invalid password length");
-                break;
-            }
-
-            String password = "";
-            for (uint8_t i = 0; i < PASSWORD_LENGTH; i++) {
-                password += static_cast<char>(data[3 + SSID_LENGTH + i]);
-            }
-
-            // Test WiFi credentials before storing permanently
-            WiFiManager::get_instance().start_wifi_credential_test(ssid, password);
-
-            break;
-        }
+    String ssid = "";
+    ssid.concat(reinterpret_cast<const char*>(payload + 1), SSID_LENGTH);
 
-        case DataMessageType::WIFI_CONNECTION_RESULT: {
-            // This is sent FROM ESP32, not handled by ESP32
-            break;
+    // Check if we're trying to forget the currently connected network
+    if (WiFiManager::get_instance().is_connected_to_ssid(ssid)) {
+        if (!SerialManager::get_instance().is_serial_connected()) {
+            SerialQueueManager::get_instance().queue_message("Cannot forget currently connected network without serial connection");
+            SerialManager::get_instance().send_network_deleted_response(false);
+            return;
         }
+        // Disconnect from WiFi before forgetting
+        WiFi.disconnect(true);
+    }
 
-        case DataMessageType::GET_SAVED_WIFI_NETWORKS: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid get saved wifi networks message length");
-            } else {
-                handle_get_saved_wifi_networks();
-            }
-            break;
-        }
+    // Attempt to forget the network
+    const bool SUCCESS = PreferencesManager::get_instance().forget_wifi_network(ssid);
+    SerialManager::get_instance().send_network_deleted_response(SUCCESS);
+}
 
-        case DataMessageType::SOFT_SCAN_WIFI_NETWORKS: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid soft scan wifi networks message length");
-            } else {
-                handle_soft_scan_wifi_networks();
-            }
-            break;
-        }
-        case DataMessageType::HARD_SCAN_WIFI_NETWORKS: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid hard scan wifi networks message length");
-            } else {
-                handle_hard_scan_wifi_networks();
-            }
-            break;
-        }
-        case DataMessageType::SPEAKER_VOLUME: {
-            if (length != 5) { // 1 byte for message type + 4 bytes for float32
-                SerialQueueManager::get_instance().queue_message("Invalid speaker volume message length");
-            } else {
-                // Extract the 4-byte float32 value (little-endian)
-                float volume = NAN;
-                memcpy(&volume, &data[1], sizeof(float));
-                Speaker::get_instance().set_volume(volume);
-            }
-            break;
-        }
-        case DataMessageType::STOP_TONE: {
-            Speaker::get_instance().stop_all_sounds();
-            break;
-        }
-        case DataMessageType::UPDATE_DISPLAY: {
-            if (length != 1025) { // 1 byte for type + 1024 bytes for buffer
-                SerialQueueManager::get_instance().queue_message("Invalid display buffer message length");
-            } else {
-                DisplayScreen::get_instance().show_custom_buffer(&data[1]);
-            }
-            break;
-        }
-        case DataMessageType::TRIGGER_MESSAGE: {
-            if (length < 3) { // 1 byte for type + 1 byte for career + 1 byte for trigger
-                SerialQueueManager::get_instance().queue_message("Invalid trigger message length");
-            } else {
-                auto career_type = static_cast<CareerType>(data[1]);
-
-                switch (career_type) {
-                    case CareerType::MEET_PIP: {
-                        auto trigger_type = static_cast<MeetPipTriggerType>(data[2]);
-
-                        switch (trigger_type) {
-                            case MeetPipTriggerType::ENTER_CAREER:
-                                DisplayScreen::get_instance().turn_display_off();
-                                Speaker::get_instance().stop_all_sounds();
-                                led_animations.fade_out();
-                                rgb_led.turn_headlights_off();
-                                break;
-                            case MeetPipTriggerType::S2_P1_ENTER:
-                                career_quest_triggers.start_s2_p1_sequence();
-                                break;
-                            case MeetPipTriggerType::S2_P1_EXIT:
-                                career_quest_triggers.stop_s2_p1_sequence();
-                                break;
-                            case MeetPipTriggerType::S2_P4_ENTER:
-                                career_quest_triggers.start_s2_p4_light_show();
-                                break;
-                            case MeetPipTriggerType::S2_P4_EXIT:
-                                career_quest_triggers.stop_s2_p4_light_show();
-                                break;
-                            case MeetPipTriggerType::S3_P3_ENTER:
-                                career_quest_triggers.start_s3_p3_display_demo();
-                                break;
-                            case MeetPipTriggerType::S3_P3_EXIT:
-                                career_quest_triggers.stop_s3_p3_display_demo();
-                                break;
-                            case MeetPipTriggerType::S4_P4_EXIT:
-                                Speaker::get_instance().stop_all_sounds();
-                                break;
-                            case MeetPipTriggerType::S4_P5_ENTER:
-                                Speaker::get_instance().start_entertainer_melody();
-                                break;
-                            case MeetPipTriggerType::S4_P5_EXIT:
-                                Speaker::get_instance().stop_all_sounds();
-                                break;
-                            case MeetPipTriggerType::S5_P4_ENTER:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_euler_data_enabled(true);
-                                SendSensorData::get_instance().set_accel_data_enabled(true);
-                                career_quest_triggers.start_s5_p4_led_visualization();
-                                break;
-                            case MeetPipTriggerType::S5_P4_EXIT:
-                                SendSensorData::get_instance().set_euler_data_enabled(false);
-                                SendSensorData::get_instance().set_accel_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                career_quest_triggers.stop_s5_p4_led_visualization();
-                                break;
-                            case MeetPipTriggerType::S5_P5_ENTER:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_euler_data_enabled(true);
-                                break;
-                            case MeetPipTriggerType::S5_P5_EXIT:
-                                SendSensorData::get_instance().set_euler_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                break;
-                            case MeetPipTriggerType::S6_P4_ENTER:
-                                SendSensorData::get_instance().set_send_multizone_data(true);
-                                rgb_led.turn_headlights_faint_blue();
-                                break;
-                            case MeetPipTriggerType::S6_P4_EXIT:
-                                SendSensorData::get_instance().set_send_multizone_data(false);
-                                rgb_led.turn_headlights_off();
-                                break;
-                            case MeetPipTriggerType::S6_P6_ENTER:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_side_tof_data_enabled(true);
-                                rgb_led.turn_front_middle_leds_faint_blue();
-                                break;
-                            case MeetPipTriggerType::S6_P6_EXIT:
-                                SendSensorData::get_instance().set_side_tof_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                rgb_led.turn_front_middle_leds_off();
-                                break;
-                            case MeetPipTriggerType::S7_P4_ENTER:
-                                career_quest_triggers.start_s7_p4_button_demo();
-                                break;
-                            case MeetPipTriggerType::S7_P4_EXIT:
-                                career_quest_triggers.stop_s7_p4_button_demo();
-                                break;
-                            case MeetPipTriggerType::S7_P6_ENTER:
-                                GameManager::get_instance().start_game(games::GameType::DINO_RUNNER);
-                                break;
-                            case MeetPipTriggerType::S7_P6_EXIT:
-                                GameManager::get_instance().stop_current_game();
-                                break;
-                            case MeetPipTriggerType::S8_P3_ENTER:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_color_sensor_data_enabled(true);
-                                break;
-                            case MeetPipTriggerType::S8_P3_EXIT:
-                                SendSensorData::get_instance().set_color_sensor_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                SensorDataBuffer::get_instance().stop_polling_sensor(SensorDataBuffer::SensorType::COLOR);
-                                break;
-                            case MeetPipTriggerType::S9_P3_ENTER:
-                                DanceManager::get_instance().start_dance();
-                                break;
-                            case MeetPipTriggerType::S9_P3_EXIT:
-                                DanceManager::get_instance().stop_dance(true);
-                                break;
-                            case MeetPipTriggerType::S9_P6_ENTER:
-                                motor_driver.stop_both_motors(); // We need this to prevent students from turning against the motors.
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_encoder_data_enabled(true);
-                                rgb_led.turn_headlights_faint_blue();
-                                break;
-                            case MeetPipTriggerType::S9_P6_EXIT:
-                                SendSensorData::get_instance().set_encoder_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                rgb_led.turn_back_leds_off();
-                                break;
-                            default:
-                                SerialQueueManager::get_instance().queue_message("Unknown introduction trigger type");
-                                break;
-                        }
-                        break;
-                    }
-                    case CareerType::TURRET_ARCADE: {
-                        auto trigger_type = static_cast<TurretArcadeTriggerType>(data[2]);
-
-                        switch (trigger_type) {
-                            case TurretArcadeTriggerType::ENTER_TURRET_ARCADE:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_euler_data_enabled(true);
-                                SendSensorData::get_instance().set_side_tof_data_enabled(true);
-                                break;
-                            case TurretArcadeTriggerType::EXIT_TURRET_ARCADE:
-                                SendSensorData::get_instance().set_euler_data_enabled(false);
-                                SendSensorData::get_instance().set_side_tof_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                break;
-                            default:
-                                SerialQueueManager::get_instance().queue_message("Unknown turret arcade trigger type");
-                                break;
-                        }
-                        break;
-                    }
-                    case CareerType::FLAPPY_BIRD_ARCADE: {
-                        auto trigger_type = static_cast<FlappyBirdArcadeTriggerType>(data[2]);
-
-                        switch (trigger_type) {
-                            case FlappyBirdArcadeTriggerType::ENTER_FLAPPY_BIRD_ARCADE:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_front_distance_data_enabled(true);
-                                break;
-                            case FlappyBirdArcadeTriggerType::EXIT_FLAPPY_BIRD_ARCADE:
-                                SendSensorData::get_instance().set_front_distance_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                break;
-                            default:
-                                SerialQueueManager::get_instance().queue_message("Unknown flappy bird arcade trigger type");
-                                break;
-                        }
-                        break;
-                    }
-                    case CareerType::CITY_DRIVING_ARCADE: {
-                        auto trigger_type = static_cast<CityDrivingArcadeTriggerType>(data[2]);
-
-                        switch (trigger_type) {
-                            case CityDrivingArcadeTriggerType::ENTER_CITY_DRIVING_ARCADE:
-                                SendSensorData::get_instance().set_send_sensor_data(true);
-                                SendSensorData::get_instance().set_encoder_data_enabled(true);
-                                break;
-                            case CityDrivingArcadeTriggerType::EXIT_CITY_DRIVING_ARCADE:
-                                SendSensorData::get_instance().set_encoder_data_enabled(false);
-                                SendSensorData::get_instance().set_send_sensor_data(false);
-                                break;
-                            default:
-                                SerialQueueManager::get_instance().queue_message("Unknown city driving arcade trigger type");
-                                break;
-                        }
-                        break;
-                    }
-                    default:
-                        SerialQueueManager::get_instance().queue_message("Unknown career type");
-                        break;
-                }
-            }
-            break;
-        }
-        case DataMessageType::STOP_CAREER_QUEST_TRIGGER: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid stop career quest trigger message length");
-            } else {
-                career_quest_triggers.stop_all_career_quest_triggers(true);
-            }
-            break;
-        }
-        case DataMessageType::SHOW_DISPLAY_START_SCREEN: {
-            if (length != 1) {
-                SerialQueueManager::get_instance().queue_message("Invalid show display start screen message length");
-            } else {
-                DisplayScreen::get_instance().show_start_screen();
-            }
-            break;
-        }
-        case DataMessageType::IS_USER_CONNECTED_TO_PIP: {
-            if (length != 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid Is user connected to pip length");
-            } else {
-                auto status = static_cast<UserConnectedStatus>(data[1]);
-                if (status == UserConnectedStatus::NOT_CONNECTED) {
-                    CommandWebSocketManager::get_instance().set_is_user_connected_to_this_pip(false);
-                } else {
-                    CommandWebSocketManager::get_instance().set_is_user_connected_to_this_pip(true);
-                    BatteryMonitor::get_instance().send_battery_monitor_data_over_websocket();
-                }
-            }
-            break;
-        }
-        case DataMessageType::FORGET_NETWORK: {
-            if (length < 2) {
-                SerialQueueManager::get_instance().queue_message("Invalid forget network message length");
-                SerialManager::get_instance().send_network_deleted_response(false);
-                break;
-            }
-
-            uint8_t ssid_length = data[1];
-            if (ssid_length == 0 || 2 + ssid_length != length) {
-                SerialQueueManager::get_instance().queue_message("Invalid SSID length in forget network message");
-                SerialManager::get_instance().send_network_deleted_response(false);
-                break;
-            }
-
-            String ssid = "";
-            for (uint8_t i = 0; i < ssid_length; i++) {
-                ssid += static_cast<char>(data[2 + i]);
-            }
-
-            // Check if we're trying to forget the currently connected network
-            if (WiFiManager::get_instance().is_connected_to_ssid(ssid)) {
-                if (!SerialManager::get_instance().is_serial_connected()) {
-                    SerialQueueManager::get_instance().queue_message("Cannot forget currently connected network without serial connection");
-                    SerialManager::get_instance().send_network_deleted_response(false);
-                    break;
-                }
-                // Disconnect from WiFi before forgetting
-                WiFi.disconnect(true);
-            }
-
-            // Attempt to forget the network
-            bool success = PreferencesManager::get_instance().forget_wifi_network(ssid);
-            SerialManager::get_instance().send_network_deleted_response(success);
-            break;
+constexpr MessageProcessor::MessageSpec MessageProcessor::DISPATCH_TABLE[];
+
+void MessageProcessor::process_message(DataMessageType message_type, const uint8_t* payload, uint16_t payload_length) {
+    TimeoutManager::get_instance().reset_activity();
+
+    // O(1) lookup on the message type; validation is uniform across all types
+    const auto TYPE_INDEX = static_cast<uint8_t>(message_type);
+    if (TYPE_INDEX >= MESSAGE_TYPE_COUNT || DISPATCH_TABLE[TYPE_INDEX].handler == nullptr) {
+        SerialQueueManager::get_instance().queue_message("Received unknown message type: " + String(static_cast<int>(TYPE_INDEX)));
+        return;
+    }
+
+    const MessageSpec& spec = DISPATCH_TABLE[TYPE_INDEX];
+    if (payload_length < spec.minPayloadLength || payload_length > spec.maxPayloadLength) {
+        if (spec.invalidLengthMessage != nullptr) {
+            SerialQueueManager::get_instance().queue_message(spec.invalidLengthMessage);
         }
-        default:
-            SerialQueueManager::get_instance().queue_message("Received unknown message type: " + String(static_cast<int>(message_type)));
-            break;
+        return;
     }
+
+    spec.handler(payload, payload_length);
 }
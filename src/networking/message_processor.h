@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 
+#include "actuators/actuator_mailbox.h"
 #include "actuators/dance_manager.h"
 #include "actuators/display_screen.h"
 #include "actuators/led/led_animations.h"
@@ -28,17 +29,123 @@ class MessageProcessor : public Singleton<MessageProcessor> {
     friend class Singleton<MessageProcessor>;
 
   public:
-    void process_binary_message(const uint8_t* data, uint16_t length);
+    // Payload is a view into the transport's receive buffer (type byte already stripped by the frame parser); it is not copied
+    void process_message(DataMessageType message_type, const uint8_t* payload, uint16_t payload_length);
 
   private:
     MessageProcessor() = default;
+
+    // Handlers receive the payload with the message type byte stripped; lengths are pre-validated against the table
+    using MessageHandler = void (*)(const uint8_t* payload, uint16_t length);
+
+    struct MessageSpec {
+        MessageHandler handler;
+        uint16_t minPayloadLength;
+        uint16_t maxPayloadLength;
+        const char* invalidLengthMessage;
+    };
+
     // Method declarations
-    static void handle_motor_control(const uint8_t* data);
-    static void handle_balance_command(BalanceStatus enable_balancing);
-    static void handle_light_command(LightAnimationStatus light_animation_status);
-    static void handle_new_light_colors(NewLightColors new_light_colors);
-    static void handle_obstacle_avoidance_command(ObstacleAvoidanceStatus status);
-    void handle_get_saved_wifi_networks();
-    static void handle_soft_scan_wifi_networks();
-    static void handle_hard_scan_wifi_networks();
+    static void handle_update_available(const uint8_t* payload, uint16_t length);
+    static void handle_motor_control(const uint8_t* payload, uint16_t length);
+    static void handle_tone_command(const uint8_t* payload, uint16_t length);
+    static void handle_speaker_mute(const uint8_t* payload, uint16_t length);
+    static void handle_balance_command(const uint8_t* payload, uint16_t length);
+    static void handle_update_balance_pids(const uint8_t* payload, uint16_t length);
+    static void handle_light_command(const uint8_t* payload, uint16_t length);
+    static void handle_new_light_colors(const uint8_t* payload, uint16_t length);
+    static void handle_bytecode_program(const uint8_t* payload, uint16_t length);
+    static void handle_stop_sandbox_code(const uint8_t* payload, uint16_t length);
+    static void handle_obstacle_avoidance_command(const uint8_t* payload, uint16_t length);
+    static void handle_serial_handshake(const uint8_t* payload, uint16_t length);
+    static void handle_serial_keepalive(const uint8_t* payload, uint16_t length);
+    static void handle_serial_end(const uint8_t* payload, uint16_t length);
+    static void handle_update_headlights(const uint8_t* payload, uint16_t length);
+    static void handle_wifi_credentials(const uint8_t* payload, uint16_t length);
+    static void handle_ignored(const uint8_t* payload, uint16_t length);
+    static void handle_get_saved_wifi_networks(const uint8_t* payload, uint16_t length);
+    static void handle_soft_scan_wifi_networks(const uint8_t* payload, uint16_t length);
+    static void handle_hard_scan_wifi_networks(const uint8_t* payload, uint16_t length);
+    static void handle_speaker_volume(const uint8_t* payload, uint16_t length);
+    static void handle_stop_tone(const uint8_t* payload, uint16_t length);
+    static void handle_update_display(const uint8_t* payload, uint16_t length);
+    static void handle_stop_sensor_polling(const uint8_t* payload, uint16_t length);
+    static void handle_trigger_message(const uint8_t* payload, uint16_t length);
+    static void handle_stop_career_quest_trigger(const uint8_t* payload, uint16_t length);
+    static void handle_show_display_start_screen(const uint8_t* payload, uint16_t length);
+    static void handle_is_user_connected_to_pip(const uint8_t* payload, uint16_t length);
+    static void handle_forget_network(const uint8_t* payload, uint16_t length);
+
+    // Indexed by DataMessageType. Payload lengths exclude the message type byte. A null invalidLengthMessage drops
+    // bad frames silently (used for high-rate streams where logging every bad frame would flood the serial queue).
+    // Every entry is a constant expression, so the table is placed in flash rather than copied to RAM at boot.
+    static constexpr MessageSpec DISPATCH_TABLE[] = {
+        // 0: UPDATE_AVAILABLE
+        {handle_update_available, 2, 2, "Invalid update available message length"},
+        // 1: MOTOR_CONTROL
+        {handle_motor_control, 4, 4, "Invalid motor control message length"},
+        // 2: TONE_COMMAND
+        {handle_tone_command, 1, 1, "Invalid sound command message length"},
+        // 3: SPEAKER_MUTE
+        {handle_speaker_mute, 1, 1, "Invalid speaker mute message length"},
+        // 4: BALANCE_CONTROL
+        {handle_balance_command, 1, 1, "Invalid balance control message length"},
+        // 5: UPDATE_BALANCE_PIDS
+        {handle_update_balance_pids, sizeof(NewBalancePids), sizeof(NewBalancePids), "Invalid update balance pids message length"},
+        // 6: UPDATE_LIGHT_ANIMATION
+        {handle_light_command, 1, 1, "Invalid light animation message length"},
+        // 7: UPDATE_LED_COLORS
+        {handle_new_light_colors, 18, 18, nullptr},
+        // 8: BYTECODE_PROGRAM
+        {handle_bytecode_program, 0, MAX_PROGRAM_SIZE, "Invalid bytecode program length"},
+        // 9: STOP_SANDBOX_CODE
+        {handle_stop_sandbox_code, 0, 0, "Invalid stop sandbox code message length"},
+        // 10: OBSTACLE_AVOIDANCE
+        {handle_obstacle_avoidance_command, 1, 1, "Invalid obstacle avoidance command"},
+        // 11: SERIAL_HANDSHAKE
+        {handle_serial_handshake, 0, UINT16_MAX, nullptr},
+        // 12: SERIAL_KEEPALIVE
+        {handle_serial_keepalive, 0, UINT16_MAX, nullptr},
+        // 13: SERIAL_END
+        {handle_serial_end, 0, UINT16_MAX, nullptr},
+        // 14: UPDATE_HEADLIGHTS
+        {handle_update_headlights, 1, 1, "Invalid update headlights message length"},
+        // 15: START_SENSOR_POLLING (unused)
+        {nullptr, 0, 0, nullptr},
+        // 16: WIFI_CREDENTIALS
+        {handle_wifi_credentials, 2, UINT16_MAX, "Invalid WiFi credentials message length"},
+        // 17: WIFI_CONNECTION_RESULT
+        {handle_ignored, 0, UINT16_MAX, nullptr},
+        // 18: GET_SAVED_WIFI_NETWORKS
+        {handle_get_saved_wifi_networks, 0, 0, "Invalid get saved wifi networks message length"},
+        // 19: SOFT_SCAN_WIFI_NETWORKS
+        {handle_soft_scan_wifi_networks, 0, 0, "Invalid soft scan wifi networks message length"},
+        // 20: HARD_SCAN_WIFI_NETWORKS
+        {handle_hard_scan_wifi_networks, 0, 0, "Invalid hard scan wifi networks message length"},
+        // 21: unassigned
+        {nullptr, 0, 0, nullptr},
+        // 22: SPEAKER_VOLUME
+        {handle_speaker_volume, sizeof(float), sizeof(float), "Invalid speaker volume message length"},
+        // 23: STOP_TONE
+        {handle_stop_tone, 0, UINT16_MAX, nullptr},
+        // 24: unassigned
+        {nullptr, 0, 0, nullptr},
+        // 25: UPDATE_DISPLAY
+        {handle_update_display, 1024, 1024, "Invalid display buffer message length"},
+        // 26: STOP_SENSOR_POLLING
+        {handle_stop_sensor_polling, 0, 0, "Invalid stop sensor polling message length"},
+        // 27: TRIGGER_MESSAGE
+        {handle_trigger_message, 2, UINT16_MAX, "Invalid trigger message length"},
+        // 28: STOP_CAREER_QUEST_TRIGGER
+        {handle_stop_career_quest_trigger, 0, 0, "Invalid stop career quest trigger message length"},
+        // 29: SHOW_DISPLAY_START_SCREEN
+        {handle_show_display_start_screen, 0, 0, "Invalid show display start screen message length"},
+        // 30: IS_USER_CONNECTED_TO_PIP
+        {handle_is_user_connected_to_pip, 1, 1, "Invalid Is user connected to pip length"},
+        // 31: FORGET_NETWORK
+        {handle_forget_network, 0, UINT16_MAX, nullptr},
+    };
+    static constexpr uint8_t MESSAGE_TYPE_COUNT = sizeof(DISPATCH_TABLE) / sizeof(DISPATCH_TABLE[0]);
+    static_assert(MESSAGE_TYPE_COUNT == static_cast<uint8_t>(DataMessageType::FORGET_NETWORK) + 1,
+                  "DISPATCH_TABLE must have one entry per DataMessageType (FORGET_NETWORK is the highest)");
 };
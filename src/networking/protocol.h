@@ -136,4 +136,5 @@ struct NewLightColors {
 
 // Markers for serial communication
 const uint8_t START_MARKER = 0xAA;
+const uint8_t START_MARKER_V2 = 0xAB; // CRC-protected, sequence-numbered frames (see frame_parser.h)
 const uint8_t END_MARKER = 0x55;
@@ -0,0 +1,75 @@
+#include "reconnect_backoff.h"
+
+void ReconnectBackoff::schedule(uint32_t now, uint32_t min_wait_ms, uint32_t max_wait_ms) {
+    _scheduledAt = now;
+    _waitMs = static_cast<uint32_t>(random(min_wait_ms, max_wait_ms + 1));
+}
+
+void ReconnectBackoff::schedule_fast_attempt(uint32_t now) {
+    _currentDelayMs = BASE_DELAY_MS;
+    schedule(now, 0, FAST_PATH_JITTER_MS);
+}
+
+void ReconnectBackoff::on_attempt_failed(uint32_t now) {
+    _failedAttempts++;
+    if (_failedAttemptsInOutage < UINT8_MAX) {
+        _failedAttemptsInOutage++;
+    }
+
+    schedule_backed_off(now);
+}
+
+void ReconnectBackoff::schedule_backed_off(uint32_t now) {
+    // "Equal jitter": double the delay, then wait somewhere between half and all of it
+    _currentDelayMs = (_currentDelayMs * 2 > MAX_DELAY_MS) ? MAX_DELAY_MS : _currentDelayMs * 2;
+    schedule(now, _currentDelayMs / 2, _currentDelayMs);
+}
+
+uint32_t ReconnectBackoff::on_connected(uint32_t now) {
+    // The delay is kept until the connection has proven stable (see on_connection_lost)
+    _isConnected = true;
+    _connectedAt = now;
+    _failedAttemptsInOutage = 0;
+    if (!_inOutage) {
+        return 0;
+    }
+
+    _inOutage = false;
+    _lastReconnectMs = now - _outageStart;
+    if (_lastReconnectMs > _maxReconnectMs) {
+        _maxReconnectMs = _lastReconnectMs;
+    }
+    _totalReconnectMs += _lastReconnectMs;
+    _reconnects++;
+    return _lastReconnectMs;
+}
+
+void ReconnectBackoff::on_connection_lost(uint32_t now) {
+    if (_inOutage) {
+        return;
+    }
+    _inOutage = true;
+    _outageStart = now;
+    _failedAttemptsInOutage = 0;
+
+    const bool WAS_SHORT_LIVED = _isConnected && now - _connectedAt < MIN_STABLE_CONNECTION_MS;
+    _isConnected = false;
+    if (WAS_SHORT_LIVED) {
+        schedule_backed_off(now);
+        return;
+    }
+
+    // Everyone connected to the same server sees it drop at the same moment - spread the first retry out
+    _currentDelayMs = BASE_DELAY_MS;
+    schedule(now, 0, BASE_DELAY_MS);
+}
+
+ReconnectStats ReconnectBackoff::get_stats() const {
+    ReconnectStats stats{};
+    stats.reconnects = _reconnects;
+    stats.failedAttempts = _failedAttempts;
+    stats.lastReconnectMs = _lastReconnectMs;
+    stats.averageReconnectMs = _reconnects == 0 ? 0 : static_cast<uint32_t>(_totalReconnectMs / _reconnects);
+    stats.maxReconnectMs = _maxReconnectMs;
+    return stats;
+}
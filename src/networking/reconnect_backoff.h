@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct ReconnectStats {
+    uint32_t reconnects;        // Connections re-established after a loss
+    uint32_t failedAttempts;    // Connect attempts that failed since boot
+    uint32_t lastReconnectMs;   // Time from losing the connection to getting it back
+    uint32_t averageReconnectMs;
+    uint32_t maxReconnectMs;
+};
+
+// Schedules WebSocket connect attempts. Failed attempts back off exponentially (with jitter so a classroom of
+// robots that lost the same AP does not hammer the server in lockstep), and the time from losing a connection
+// to re-establishing it is measured. Owned and driven by a single polling task, so it is not thread-safe.
+class ReconnectBackoff {
+  public:
+    bool is_attempt_due(uint32_t now) const {
+        return now - _scheduledAt >= _waitMs;
+    }
+
+    // Skips whatever backoff is left: the next attempt happens within FAST_PATH_JITTER_MS.
+    // Used when WiFi has just (re)connected, since the server is then most likely reachable again.
+    void schedule_fast_attempt(uint32_t now);
+
+    void on_attempt_failed(uint32_t now);
+
+    // Returns the time-to-reconnect in ms, or 0 if this was not a reconnect (e.g. the first connection)
+    uint32_t on_connected(uint32_t now);
+
+    // Safe to call repeatedly for the same outage - only the first call starts the reconnect timer.
+    // The delay only drops back to base if the connection stayed up for MIN_STABLE_CONNECTION_MS; a server that
+    // accepts and then drops straight away keeps being backed off like a failed attempt.
+    void on_connection_lost(uint32_t now);
+
+    uint8_t get_failed_attempts_in_outage() const {
+        return _failedAttemptsInOutage;
+    }
+
+    ReconnectStats get_stats() const;
+
+  private:
+    void schedule(uint32_t now, uint32_t min_wait_ms, uint32_t max_wait_ms);
+    void schedule_backed_off(uint32_t now);
+
+    static constexpr uint32_t BASE_DELAY_MS = 1000;
+    static constexpr uint32_t MAX_DELAY_MS = 30000;
+    static constexpr uint32_t FAST_PATH_JITTER_MS = 500;
+    static constexpr uint32_t MIN_STABLE_CONNECTION_MS = 10000;
+
+    uint32_t _scheduledAt = 0;
+    uint32_t _waitMs = 0;
+    uint32_t _currentDelayMs = BASE_DELAY_MS;
+
+    bool _isConnected = false;
+    uint32_t _connectedAt = 0;
+
+    bool _inOutage = false;
+    uint32_t _outageStart = 0;
+    uint8_t _failedAttemptsInOutage = 0;
+
+    uint32_t _reconnects = 0;
+    uint32_t _failedAttempts = 0;
+    uint32_t _lastReconnectMs = 0;
+    uint32_t _maxReconnectMs = 0;
+    uint64_t _totalReconnectMs = 0;
+};
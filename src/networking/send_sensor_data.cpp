@@ -49,12 +49,14 @@ void SendSensorData::attach_color_sensor_data(JsonObject& payload) {
     payload["redValue"] = color_sensor_data.red_value;
     payload["greenValue"] = color_sensor_data.green_value;
     payload["blueValue"] = color_sensor_data.blue_value;
+    payload["colorClass"] = static_cast<int>(color_sensor_data.color_class);
+    payload["colorConfidence"] = color_sensor_data.class_confidence;
 }
 
 void SendSensorData::attach_multizone_tof_data(JsonObject& payload) {
     TofData tof_data = SensorDataBuffer::get_instance().get_latest_tof_data();
     JsonArray distance_array = payload.createNestedArray("distanceGrid");
-    for (short& i : tof_data.raw_data.distance_mm) {
+    for (short& i : tof_data.frame.distance_mm) {
         distance_array.add(i);
     }
 }
@@ -70,6 +72,16 @@ void SendSensorData::attach_front_distance_data(JsonObject& payload) {
     payload["frontTofDistance"] = front_tof_distance;
 }
 
+void SendSensorData::attach_pose_data(JsonObject& payload) {
+    PoseData pose = SensorDataBuffer::get_instance().get_latest_pose();
+    if (!pose.is_valid) {
+        return;
+    }
+    payload["poseX"] = pose.x_in;
+    payload["poseY"] = pose.y_in;
+    payload["poseHeading"] = pose.heading_deg;
+}
+
 void SendSensorData::send_sensor_data_to_server() {
     if (!_sendSensorData) {
         return;
@@ -83,7 +95,9 @@ void SendSensorData::send_sensor_data_to_server() {
     }
 
     const uint32_t CURRENT_TIME = millis();
-    uint32_t required_interval = serial_connected ? SERIAL_SEND_INTERVAL : WS_SEND_INTERVAL;
+    // Over WebSocket the rate backs off while the link is congested instead of queueing stale samples
+    uint32_t required_interval =
+        serial_connected ? SERIAL_SEND_INTERVAL : WS_SEND_INTERVAL * SensorWebSocketManager::get_instance().get_telemetry_downsample();
     if (CURRENT_TIME - _lastSendTime < required_interval) {
         return;
     }
@@ -115,6 +129,9 @@ void SendSensorData::send_sensor_data_to_server() {
     if (_sendFrontDistanceData) {
         attach_front_distance_data(payload);
     }
+    if (_sendPoseData) {
+        attach_pose_data(payload);
+    }
 
     String json_string;
     serializeJson(doc, json_string);
@@ -122,7 +139,7 @@ void SendSensorData::send_sensor_data_to_server() {
     if (serial_connected) {
         SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
     } else if (websocket_connected) {
-        SensorWebSocketManager::get_instance()._wsClient.send(json_string); // CHANGED
+        SensorWebSocketManager::get_instance().send(json_string);
     }
 
     _lastSendTime = CURRENT_TIME;
@@ -141,7 +158,8 @@ void SendSensorData::send_multizone_data() {
     }
 
     const uint32_t CURRENT_TIME = millis();
-    uint32_t required_mz_interval = serial_connected ? SERIAL_MZ_INTERVAL : WS_MZ_INTERVAL;
+    uint32_t required_mz_interval =
+        serial_connected ? SERIAL_MZ_INTERVAL : WS_MZ_INTERVAL * SensorWebSocketManager::get_instance().get_telemetry_downsample();
     if (CURRENT_TIME - _lastMzSendTime < required_mz_interval) {
         return;
     }
@@ -155,7 +173,7 @@ void SendSensorData::send_multizone_data() {
 
         JsonArray distances = payload.createNestedArray("distances");
         for (int col = 0; col < 8; col++) {
-            int16_t distance = tof_data.raw_data.distance_mm[(row * 8) + col];
+            int16_t distance = tof_data.frame.distance_mm[(row * 8) + col];
             distances.add(distance == 0 ? -1 : distance);
         }
 
@@ -165,7 +183,7 @@ void SendSensorData::send_multizone_data() {
         if (serial_connected) {
             SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
         } else if (websocket_connected) {
-            SensorWebSocketManager::get_instance()._wsClient.send(json_string); // CHANGED
+            SensorWebSocketManager::get_instance().send(json_string);
         }
     }
 
@@ -50,6 +50,9 @@ class SendSensorData : public Singleton<SendSensorData> {
     void set_front_distance_data_enabled(bool enabled) {
         _sendFrontDistanceData = enabled;
     }
+    void set_pose_data_enabled(bool enabled) {
+        _sendPoseData = enabled;
+    }
 
   private:
     SendSensorData() = default;
@@ -64,6 +67,7 @@ class SendSensorData : public Singleton<SendSensorData> {
     bool _sendColorSensorData = false;
     bool _sendEncoderData = false;
     bool _sendFrontDistanceData = false;
+    bool _sendPoseData = false;
 
     static void attach_rpm_data(JsonObject& payload);
     static void attach_color_sensor_data(JsonObject& payload);
@@ -74,6 +78,7 @@ class SendSensorData : public Singleton<SendSensorData> {
     static void attach_multizone_tof_data(JsonObject& payload);
     static void attach_side_tof_data(JsonObject& payload);
     static void attach_front_distance_data(JsonObject& payload);
+    static void attach_pose_data(JsonObject& payload);
     void send_sensor_data_to_server();
     void send_multizone_data();
 
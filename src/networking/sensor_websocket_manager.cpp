@@ -1,19 +1,59 @@
 #include "sensor_websocket_manager.h"
 
+#include "networking/command_websocket_manager.h"
+
 SensorWebSocketManager::SensorWebSocketManager() {
     _wsConnected = false;
-    _lastConnectionAttempt = 0;
 
     String pip_id = PreferencesManager::get_instance().get_pip_id();
     _wsClient.addHeader("X-Pip-Id", pip_id);
 
-    if (DEFAULT_ENVIRONMENT == "local") {
+    if (!USE_MULTIPLEXED_WEBSOCKET) {
+        _outbox.initialize(false);
+        _outbox.enable_channel(WsChannel::TELEMETRY);
+    }
+
+    // In multiplexed mode this socket never connects, so skip the TLS setup entirely
+    if (USE_MULTIPLEXED_WEBSOCKET || DEFAULT_ENVIRONMENT == "local") {
         return;
     }
     _wsClient.setCACert(ROOT_CA_CERTIFICATE);
 }
 
+void SensorWebSocketManager::send(const String& message) {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        CommandWebSocketManager::send_message(message, WsChannel::TELEMETRY);
+        return;
+    }
+    _outbox.enqueue(WsChannel::TELEMETRY, message.c_str(), message.length());
+}
+
+uint8_t SensorWebSocketManager::get_telemetry_downsample() const {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        return CommandWebSocketManager::get_instance().get_telemetry_downsample();
+    }
+    return _outbox.get_telemetry_downsample();
+}
+
+WsLinkStats SensorWebSocketManager::get_link_stats() const {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        return CommandWebSocketManager::get_instance().get_link_stats();
+    }
+    return _outbox.get_link_stats();
+}
+
+bool SensorWebSocketManager::is_ws_connected() const {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        return CommandWebSocketManager::get_instance().is_ws_connected();
+    }
+    return _wsConnected;
+}
+
 void SensorWebSocketManager::connect_to_websocket() {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        return; // Telemetry rides the command connection
+    }
+
     // Simple connection - no ping/pong handlers needed
     _wsClient.onEvent([this](WebsocketsEvent event, String data) {
         switch (event) {
@@ -24,16 +64,22 @@ void SensorWebSocketManager::connect_to_websocket() {
             case WebsocketsEvent::ConnectionClosed:
                 SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Connection closed");
                 this->_wsConnected = false;
+                this->_reconnect.on_connection_lost(millis());
+                this->_outbox.clear();
                 break;
             default:
                 break;
         }
     });
 
-    _lastConnectionAttempt = 0; // Force an immediate connection attempt
+    _reconnect.schedule_fast_attempt(millis());
 }
 
 void SensorWebSocketManager::poll_websocket() {
+    if (USE_MULTIPLEXED_WEBSOCKET) {
+        return;
+    }
+
     SensorWebSocketManager& instance = SensorWebSocketManager::get_instance();
     const uint32_t CURRENT_TIME = millis();
 
@@ -47,14 +93,20 @@ void SensorWebSocketManager::poll_websocket() {
         if (instance._wsConnected) {
             SerialQueueManager::get_instance().queue_message("[WS_SENSOR] WiFi lost during session", SerialPriority::HIGH_PRIO);
             instance._wsConnected = false;
+            instance._reconnect.on_connection_lost(CURRENT_TIME);
         }
+        instance._wifiLost = true;
         return;
     }
 
-    // Connection management - try to connect if not connected
-    if (!instance._wsConnected && (CURRENT_TIME - instance._lastConnectionAttempt >= CONNECTION_INTERVAL)) {
-        instance._lastConnectionAttempt = CURRENT_TIME;
+    if (instance._wifiLost) {
+        // WiFi just came back - skip the remaining backoff
+        instance._wifiLost = false;
+        instance._reconnect.schedule_fast_attempt(CURRENT_TIME);
+    }
 
+    // Connection management - try to connect if not connected
+    if (!instance._wsConnected && instance._reconnect.is_attempt_due(CURRENT_TIME)) {
         SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Attempting to connect...");
 
         // Connect to sensor endpoint
@@ -62,10 +114,17 @@ void SensorWebSocketManager::poll_websocket() {
         url.replace("/esp32", "/ws-sensor"); // Use different endpoint
 
         if (!instance._wsClient.connect(url)) {
-            SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Connection failed");
+            instance._reconnect.on_attempt_failed(millis());
+            SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Connection failed (attempt " +
+                                                             String(instance._reconnect.get_failed_attempts_in_outage()) + ")");
         } else {
-            SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Connected successfully");
+            const uint32_t RECONNECT_MS = instance._reconnect.on_connected(millis());
             instance._wsConnected = true;
+            if (RECONNECT_MS > 0) {
+                SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Reconnected after " + String(RECONNECT_MS) + " ms");
+            } else {
+                SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Connected successfully");
+            }
         }
         return;
     }
@@ -77,7 +136,9 @@ void SensorWebSocketManager::poll_websocket() {
 
     try {
         instance._wsClient.poll();
+        instance._outbox.drain(instance._wsClient, MAX_SENDS_PER_POLL);
     } catch (const std::exception& e) {
         instance._wsConnected = false;
+        instance._reconnect.on_connection_lost(millis());
     }
 }
@@ -4,7 +4,9 @@
 
 #include <ArduinoWebsockets.h>
 
+#include "networking/reconnect_backoff.h"
 #include "networking/serial_queue_manager.h"
+#include "networking/websocket_outbox.h"
 #include "utils/config.h"
 #include "utils/preferences_manager.h"
 #include "utils/singleton.h"
@@ -13,27 +15,38 @@ using namespace websockets;
 
 class SensorWebSocketManager : public Singleton<SensorWebSocketManager> {
     friend class Singleton<SensorWebSocketManager>;
-    friend class SendSensorData;
 
   public:
     void connect_to_websocket();
     void poll_websocket();
 
-    bool is_ws_connected() const {
-        return _wsConnected;
+    // Queues telemetry for this socket (or the command socket's telemetry channel in multiplexed mode).
+    // Never blocks the caller on the network; stale telemetry is shed when the link backs up.
+    void send(const String& message);
+
+    bool is_ws_connected() const;
+
+    // Producers divide their telemetry rate by this (1, 2, 4 or 8) while the link is congested
+    uint8_t get_telemetry_downsample() const;
+    WsLinkStats get_link_stats() const;
+
+    ReconnectStats get_reconnect_stats() const {
+        return _reconnect.get_stats();
     }
 
   private:
     SensorWebSocketManager();
 
     websockets::WebsocketsClient _wsClient;
+    WebSocketOutbox _outbox; // Unused in multiplexed mode
 
     uint32_t _lastPollTime = 0;
     const uint32_t POLL_INTERVAL = 5; // Poll every 5ms for fast sends
 
     bool _wsConnected = false;
-    uint32_t _lastConnectionAttempt = 0;
-    const uint32_t CONNECTION_INTERVAL = 3000; // 3 seconds between connection attempts
+    bool _wifiLost = true; // Until WiFi first connects, so the first attempt takes the fast path
+    ReconnectBackoff _reconnect;
+    static constexpr uint8_t MAX_SENDS_PER_POLL = 16;
 
     // No ping/pong tracking - this connection is for sending only
 };
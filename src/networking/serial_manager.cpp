@@ -1,5 +1,39 @@
 #include "serial_manager.h"
 
+#include <algorithm>
+
+TaskHandle_t SerialManager::_rxTaskHandle = nullptr;
+
+void SerialManager::on_serial_rx_event(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
+    (void)arg;
+    (void)event_base;
+    (void)event_id;
+    (void)event_data;
+    if (_rxTaskHandle != nullptr) {
+        xTaskNotifyGive(_rxTaskHandle);
+    }
+}
+
+void SerialManager::wait_for_serial_data() {
+    if (_rxTaskHandle == nullptr) {
+        _rxTaskHandle = xTaskGetCurrentTaskHandle();
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+        Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, on_serial_rx_event);
+#endif
+    }
+
+    if (Serial.available() > 0) {
+        return;
+    }
+
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RX_WAIT_TIMEOUT_MS));
+#else
+    // No RX event source on this serial backend - fall back to polling
+    vTaskDelay(pdMS_TO_TICKS(2));
+#endif
+}
+
 void SerialManager::poll_serial() {
     if (Serial.available() <= 0) {
         // Check for timeout if we're connected but haven't received data for a while
@@ -9,6 +43,7 @@ void SerialManager::poll_serial() {
                 career_quest_triggers.stop_all_career_quest_triggers(false);
             }
         }
+        expire_stalled_partial_frame();
         return;
     }
 
@@ -16,96 +51,155 @@ void SerialManager::poll_serial() {
 
     if (!is_serial_connected()) {
         _isConnected = true;
+        _rxSequence.reset();
         // If we were previously trying to connect to wifi (breathing red), we should turn it off when connecting to serial
         led_animations.stop_animation();
     }
 
-    // Read available bytes and process according to the current state
-    while (Serial.available() > 0) {
-        uint8_t in_byte = Serial.read();
-
-        switch (_parseState) {
-            case ParseState::WAITING_FOR_START:
-                if (in_byte == START_MARKER) {
-                    // Start of a new message
-                    _bufferPosition = 0;
-                    _parseState = ParseState::READING_MESSAGE_TYPE;
-                }
-                break;
-
-            case ParseState::READING_MESSAGE_TYPE:
-                _receiveBuffer[_bufferPosition++] = in_byte; // Store message type as first byte
-                _parseState = ParseState::READING_FORMAT_FLAG;
-                break;
-
-            case ParseState::READING_FORMAT_FLAG:
-                _useLongFormat = (in_byte != 0);
-                _parseState = ParseState::READING_LENGTH_BYTE1;
-                break;
-
-            case ParseState::READING_LENGTH_BYTE1:
-                if (_useLongFormat) {
-                    // First byte of 16-bit length (little-endian)
-                    _expectedPayloadLength = in_byte;
-                    _parseState = ParseState::READING_LENGTH_BYTE2;
-                } else {
-                    // 8-bit length
-                    _expectedPayloadLength = in_byte;
-
-                    // If payload length is 0, skip to waiting for end marker
-                    if (_expectedPayloadLength == 0) {
-                        _parseState = ParseState::WAITING_FOR_END;
-                    } else {
-                        _parseState = ParseState::READING_PAYLOAD;
-                    }
-                }
-                break;
-
-            case ParseState::READING_LENGTH_BYTE2:
-                // Second byte of 16-bit length (little-endian)
-                _expectedPayloadLength |= (in_byte << 8);
-
-                // If payload length is 0, skip to waiting for end marker
-                if (_expectedPayloadLength == 0) {
-                    _parseState = ParseState::WAITING_FOR_END;
-                } else {
-                    _parseState = ParseState::READING_PAYLOAD;
-                }
-                break;
-
-            case ParseState::READING_PAYLOAD:
-                // Store payload byte
-                if (_bufferPosition < sizeof(_receiveBuffer)) {
-                    _receiveBuffer[_bufferPosition++] = in_byte;
-
-                    // Check if we've read the complete payload
-                    if (_bufferPosition >= _expectedPayloadLength + 1) { // +1 for message type
-                        _parseState = ParseState::WAITING_FOR_END;
-                    }
-                } else {
-                    // Buffer overflow
-                    SerialQueueManager::get_instance().queue_message("Serial buffer overflow");
-                    _parseState = ParseState::WAITING_FOR_START;
-                }
-                break;
-
-            case ParseState::WAITING_FOR_END:
-                if (in_byte == END_MARKER) {
-                    // Process the message
-                    MessageProcessor::get_instance().process_binary_message(_receiveBuffer, _bufferPosition);
-
-                    // Reset for next message
-                    _parseState = ParseState::WAITING_FOR_START;
-                } else {
-                    // Invalid end marker
-                    SerialQueueManager::get_instance().queue_message("Invalid end marker");
-                    _parseState = ParseState::WAITING_FOR_START;
-                }
-                break;
+    drain_serial_into_buffer();
+}
+
+void SerialManager::drain_serial_into_buffer() {
+    int available = Serial.available();
+    while (available > 0) {
+        if (_rxTail == RX_BUFFER_SIZE) {
+            compact_rx_buffer();
+        }
+        if (_rxTail == RX_BUFFER_SIZE) {
+            // Cannot happen for well-formed frames (length is bounded by MAX_PROGRAM_SIZE), but never wedge the parser
+            SerialQueueManager::get_instance().queue_message("Serial buffer overflow");
+            _rxHead = 0;
+            _rxTail = 0;
+        }
+
+        // One bulk copy out of the USB-CDC driver instead of a virtual call per byte
+        const size_t SPACE = RX_BUFFER_SIZE - _rxTail;
+        const size_t BYTES_READ = Serial.read(_rxBuffer + _rxTail, std::min(SPACE, static_cast<size_t>(available)));
+        if (BYTES_READ == 0) {
+            break;
         }
+        _rxTail += BYTES_READ;
+        _partialFrameSince = millis(); // A frame is only stalled once bytes stop arriving, however long it is
+
+        parse_buffered_frames();
+        available = Serial.available();
     }
 }
 
+void SerialManager::parse_buffered_frames() {
+    while (_rxHead < _rxTail) {
+        // Resync on the next start marker, discarding anything in between
+        const uint8_t* start = FrameParser::find_start(_rxBuffer + _rxHead, _rxTail - _rxHead);
+        if (start == nullptr) {
+            _rxHead = _rxTail;
+            break;
+        }
+        _rxHead = start - _rxBuffer;
+
+        ParsedFrame frame;
+        const FrameParseResult RESULT = FrameParser::parse(_rxBuffer + _rxHead, _rxTail - _rxHead, frame);
+        if (RESULT == FrameParseResult::INCOMPLETE) {
+            if (_partialFrameStart != _rxHead) {
+                _partialFrameStart = _rxHead;
+                _partialFrameSince = millis();
+            }
+            break; // Wait for the rest of the frame
+        }
+        _partialFrameStart = UINT16_MAX;
+
+        if (RESULT != FrameParseResult::COMPLETE) {
+            // This start marker was not a real frame - rescan from the next byte
+            reject_frame(RESULT, frame);
+            _rxHead++;
+            continue;
+        }
+
+        _rxHead += frame.frameSize;
+
+        if (frame.isV2) {
+            // ACK on receipt so the host can keep pipelining; retransmissions are re-ACKed but not re-run
+            send_frame_ack(frame.sequence);
+            if (!_rxSequence.accept(frame.sequence)) {
+                continue;
+            }
+        }
+
+        // The payload is handed over in place; it stays valid until the next compact_rx_buffer()
+        MessageProcessor::get_instance().process_message(static_cast<DataMessageType>(frame.messageType), frame.payload,
+                                                         frame.payloadLength);
+    }
+
+    if (_rxHead == _rxTail) {
+        _rxHead = 0;
+        _rxTail = 0;
+        _partialFrameStart = UINT16_MAX;
+    }
+}
+
+void SerialManager::expire_stalled_partial_frame() {
+    if (_rxHead == _rxTail || _partialFrameStart != _rxHead || millis() - _partialFrameSince < PARTIAL_FRAME_TIMEOUT_MS) {
+        return;
+    }
+
+    ParsedFrame frame;
+    FrameParser::parse(_rxBuffer + _rxHead, _rxTail - _rxHead, frame);
+    reject_frame(FrameParseResult::BAD_LENGTH, frame);
+
+    _partialFrameStart = UINT16_MAX;
+    _rxHead++;
+    parse_buffered_frames();
+}
+
+void SerialManager::reject_frame(FrameParseResult result, const ParsedFrame& frame) {
+    if (frame.isV2) {
+        send_frame_nack(_rxSequence.next_expected(), result);
+        return;
+    }
+    if (result == FrameParseResult::BAD_END_MARKER) {
+        SerialQueueManager::get_instance().queue_message("Invalid end marker");
+    } else {
+        SerialQueueManager::get_instance().queue_message("Serial buffer overflow");
+    }
+}
+
+void SerialManager::send_frame_ack(uint8_t sequence) {
+    auto doc = make_base_message_common<96>(ToCommonMessage::FRAME_ACK);
+    JsonObject payload = doc.createNestedObject("payload");
+    payload["seq"] = sequence;
+    payload["ack"] = true;
+
+    String json_string;
+    serializeJson(doc, json_string);
+
+    SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
+}
+
+void SerialManager::send_frame_nack(uint8_t expected_sequence, FrameParseResult reason) {
+    auto doc = make_base_message_common<128>(ToCommonMessage::FRAME_ACK);
+    JsonObject payload = doc.createNestedObject("payload");
+    payload["ack"] = false;
+    payload["expectedSeq"] = expected_sequence;
+    payload["reason"] = FrameParser::result_to_string(reason);
+
+    String json_string;
+    serializeJson(doc, json_string);
+
+    SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
+}
+
+void SerialManager::compact_rx_buffer() {
+    if (_rxHead == 0) {
+        return;
+    }
+    // Only the unparsed tail (at most one partial frame) is moved
+    memmove(_rxBuffer, _rxBuffer + _rxHead, _rxTail - _rxHead);
+    if (_partialFrameStart != UINT16_MAX) {
+        _partialFrameStart -= _rxHead;
+    }
+    _rxTail -= _rxHead;
+    _rxHead = 0;
+}
+
 void SerialManager::send_pip_id_message() {
     if (!is_serial_connected()) {
         return;
@@ -177,10 +271,48 @@ void SerialManager::send_scan_results_response(const std::vector<WiFiNetworkInfo
         SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
     }
 
-    // Send completion message
+    send_scan_complete_message(networks.size());
+}
+
+void SerialManager::send_scan_diffs(const std::vector<WiFiScanDiff>& diffs) {
+    if (!is_serial_connected()) {
+        return;
+    }
+
+    // Batched so one scanned channel is normally a single message. Entries are keyed by SSID on the browser side:
+    // "added"/"changed" upsert the network, "removed" drops it
+    for (size_t first = 0; first < diffs.size(); first += SCAN_DIFFS_PER_MESSAGE) {
+        auto doc = make_base_message_serial<1024>(ToSerialMessage::SCAN_DIFF);
+        JsonArray payload = doc.createNestedArray("payload");
+
+        const size_t LAST = std::min(diffs.size(), first + SCAN_DIFFS_PER_MESSAGE);
+        for (size_t i = first; i < LAST; i++) {
+            const JsonObject DIFF = payload.createNestedObject();
+            DIFF["ssid"] = diffs[i].network.ssid;
+            if (diffs[i].change == WiFiScanChange::REMOVED) {
+                DIFF["op"] = "removed";
+                continue;
+            }
+            DIFF["op"] = diffs[i].change == WiFiScanChange::ADDED ? "added" : "changed";
+            DIFF["rssi"] = diffs[i].network.rssi;
+            DIFF["encrypted"] = (diffs[i].network.encryptionType != WIFI_AUTH_OPEN);
+        }
+
+        String json_string;
+        serializeJson(doc, json_string);
+
+        SerialQueueManager::get_instance().queue_message(json_string, SerialPriority::CRITICAL);
+    }
+}
+
+void SerialManager::send_scan_complete_message(size_t total_networks) {
+    if (!is_serial_connected()) {
+        return;
+    }
+
     auto complete_doc = make_base_message_serial<256>(ToSerialMessage::SCAN_COMPLETE);
     JsonObject complete_payload = complete_doc.createNestedObject("payload");
-    complete_payload["totalNetworks"] = networks.size();
+    complete_payload["totalNetworks"] = total_networks;
 
     String complete_json_string;
     serializeJson(complete_doc, complete_json_string);
@@ -2,8 +2,12 @@
 #include <ArduinoJson.h>
 #include <freertos/FreeRTOS.h> // Must be first!
 
+#include <esp_event.h>
+
 #include "actuators/led/rgb_led.h"
+#include "frame_parser.h"
 #include "message_processor.h"
+#include "wifi_scan_table.h"
 #include "sensors/battery_monitor.h"
 #include "serial_queue_manager.h"
 #include "utils/config.h"
@@ -16,6 +20,8 @@ class SerialManager : public Singleton<SerialManager> {
 
   public:
     void poll_serial();
+    // Blocks the calling task until USB-CDC signals received data (or a short timeout elapses)
+    void wait_for_serial_data();
     bool is_serial_connected() const {
         return _isConnected;
     }
@@ -25,6 +31,8 @@ class SerialManager : public Singleton<SerialManager> {
     void send_saved_networks_response(const std::vector<WiFiCredentials>& networks);
     void send_scan_results_response(const std::vector<WiFiNetworkInfo>& networks);
     void send_scan_started_message();
+    void send_scan_diffs(const std::vector<WiFiScanDiff>& diffs);
+    void send_scan_complete_message(size_t total_networks);
     void send_battery_monitor_data();
     void send_dino_score(int score);
     void send_network_deleted_response(bool success);
@@ -32,20 +40,34 @@ class SerialManager : public Singleton<SerialManager> {
 
   private:
     SerialManager() = default; // Make constructor private and implement it
-    enum class ParseState : uint8_t {
-        WAITING_FOR_START,
-        READING_MESSAGE_TYPE,
-        READING_FORMAT_FLAG,
-        READING_LENGTH_BYTE1,
-        READING_LENGTH_BYTE2,
-        READING_PAYLOAD,
-        WAITING_FOR_END
-    };
-    ParseState _parseState = ParseState::WAITING_FOR_START;
-    uint8_t _receiveBuffer[MAX_PROGRAM_SIZE]{};
-    uint16_t _bufferPosition = 0;
-    uint16_t _expectedPayloadLength = 0;
-    bool _useLongFormat = false;
+
+    // Frame layouts (v1 and CRC-protected v2) are described in frame_parser.h
+    static constexpr uint16_t RX_BUFFER_SIZE = MAX_PROGRAM_SIZE + 512;
+    static constexpr uint32_t RX_WAIT_TIMEOUT_MS = 50; // Upper bound so connection timeouts are still noticed while idle
+    // A partial frame that stops growing for this long most likely has a corrupted length - resync past it
+    static constexpr uint32_t PARTIAL_FRAME_TIMEOUT_MS = 200;
+
+    // Bytes are drained from USB-CDC in bulk into this buffer. Frames are parsed in place and handed to
+    // MessageProcessor as spans into it; only a trailing partial frame is ever moved (to the front).
+    uint8_t _rxBuffer[RX_BUFFER_SIZE]{};
+    uint16_t _rxHead = 0; // First unconsumed byte
+    uint16_t _rxTail = 0; // One past the last received byte
+    uint16_t _partialFrameStart = UINT16_MAX;
+    uint32_t _partialFrameSince = 0; // millis() of the last byte received while a frame was incomplete
+    FrameSequenceTracker _rxSequence;
+
+    static TaskHandle_t _rxTaskHandle;
+
+    void drain_serial_into_buffer();
+    void parse_buffered_frames();
+    void compact_rx_buffer();
+    void expire_stalled_partial_frame();
+    void reject_frame(FrameParseResult result, const ParsedFrame& frame);
+    void send_frame_ack(uint8_t sequence);
+    void send_frame_nack(uint8_t expected_sequence, FrameParseResult reason);
+    static void on_serial_rx_event(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
+
+    static constexpr uint8_t SCAN_DIFFS_PER_MESSAGE = 8;
 
     const uint32_t SERIAL_CONNECTION_TIMEOUT = 400;
     bool _isConnected = false;
@@ -1,105 +1,277 @@
 #include "serial_queue_manager.h"
 
+#include <algorithm>
+
+namespace {
+    struct PriorityLevelConfig {
+        size_t arenaSize;
+        SerialDropPolicy dropPolicy;
+    };
+
+    // Indexed by SerialPriority. Browser responses get the most room and are never evicted;
+    // verbose logs are rejected outright once their small arena fills up.
+    constexpr PriorityLevelConfig LEVEL_CONFIG[SerialQueueManager::NUM_PRIORITY_LEVELS] = {
+        {4096, SerialDropPolicy::BLOCK_THEN_DROP_NEWEST}, // CRITICAL
+        {2048, SerialDropPolicy::DROP_OLDEST},            // HIGH_PRIO
+        {1024, SerialDropPolicy::DROP_OLDEST},            // NORMAL
+        {1024, SerialDropPolicy::DROP_NEWEST}             // LOW_PRIO
+    };
+
+    constexpr const char* PRIORITY_NAMES[SerialQueueManager::NUM_PRIORITY_LEVELS] = {"crit", "high", "normal", "low"};
+} // namespace
+
 void SerialQueueManager::initialize() {
-    // Create the message queue
-    _messageQueue = xQueueCreate(SERIAL_QUEUE_SIZE, sizeof(SerialMessage));
-    if (_messageQueue == nullptr) {
-        Serial.println("ERROR: Failed to create serial message queue!");
+    // Counts outstanding records across all levels (upper bound is generous; it only gates sleeping)
+    _pendingRecords = xSemaphoreCreateCounting(UINT16_MAX, 0);
+    if (_pendingRecords == nullptr) {
+        Serial.println("ERROR: Failed to create serial queue semaphore!");
         return;
     }
 
+    for (uint8_t i = 0; i < NUM_PRIORITY_LEVELS; i++) {
+        _levels[i].writeLock = xSemaphoreCreateMutex();
+        _levels[i].readLock = xSemaphoreCreateMutex();
+        if (_levels[i].writeLock == nullptr || _levels[i].readLock == nullptr) {
+            Serial.println("ERROR: Failed to create serial arena locks!");
+            return;
+        }
+
+        // No-split so each record is contiguous and can be read in place
+        _levels[i].arena = xRingbufferCreate(LEVEL_CONFIG[i].arenaSize, RINGBUF_TYPE_NOSPLIT);
+        if (_levels[i].arena == nullptr) {
+            Serial.println("ERROR: Failed to create serial message arena!");
+            return;
+        }
+        _levels[i].maxPayloadPerRecord = xRingbufferGetMaxItemSize(_levels[i].arena) - sizeof(SerialMessageHeader);
+        _levels[i].dropPolicy = LEVEL_CONFIG[i].dropPolicy;
+    }
+
     Serial.println("SerialQueueManager initialized - task will be created by TaskManager");
 }
 
 bool SerialQueueManager::queue_message(const String& msg, SerialPriority priority) {
-    return queue_message(msg.c_str(), priority);
+    return enqueue(msg.c_str(), msg.length(), priority);
 }
 
 bool SerialQueueManager::queue_message(const char* msg, SerialPriority priority) {
-    if (_messageQueue == nullptr || msg == nullptr) {
+    if (msg == nullptr) {
         return false;
     }
+    return enqueue(msg, strlen(msg), priority);
+}
 
-    // Create message structure
-    SerialMessage message;
-    message.priority = priority;
-    message.timestamp = millis();
+bool SerialQueueManager::enqueue(const char* msg, size_t length, SerialPriority priority) {
+    const auto LEVEL_INDEX = static_cast<uint8_t>(priority);
+    if (msg == nullptr || LEVEL_INDEX >= NUM_PRIORITY_LEVELS) {
+        return false;
+    }
 
-    // Copy message, ensuring null termination and not exceeding buffer
-    size_t msg_len = strlen(msg);
-    if (msg_len >= sizeof(message.message)) {
-        msg_len = sizeof(message.message) - 1;
+    PriorityLevel& level = _levels[LEVEL_INDEX];
+    if (level.arena == nullptr) {
+        return false;
     }
 
-    strncpy(message.message, msg, msg_len);
-    message.message[msg_len] = '\0';
-    message.length = msg_len;
+    SerialMessageHeader header;
+    header.priority = priority;
+    header.timestamp = millis();
 
-    return add_message_to_queue(message);
+    // Messages larger than one record are split into continuation fragments rather than truncated
+    if (!add_message_to_arena(level, header, msg, length)) {
+        level.dropped++;
+        return false;
+    }
+    return true;
 }
 
-bool SerialQueueManager::add_message_to_queue(const SerialMessage& msg) {
-    // Try to send to queue without blocking
-    BaseType_t result = xQueueSend(_messageQueue, &msg, 0);
+bool SerialQueueManager::enqueue_deferred(LogFormat format, const DeferredLogArg* args, uint8_t arg_count, SerialPriority priority) {
+    const auto LEVEL_INDEX = static_cast<uint8_t>(priority);
+    if (LEVEL_INDEX >= NUM_PRIORITY_LEVELS || _levels[LEVEL_INDEX].arena == nullptr) {
+        return false;
+    }
+    PriorityLevel& level = _levels[LEVEL_INDEX];
+
+    uint8_t encoded[deferred_log::MAX_ENCODED_SIZE];
+    SerialMessageHeader header;
+    header.priority = priority;
+    header.timestamp = millis();
+    header.flags = FLAG_DEFERRED;
+    const size_t LENGTH = deferred_log::encode(format, args, arg_count, encoded);
+
+    if (!add_message_to_arena(level, header, reinterpret_cast<const char*>(encoded), LENGTH)) {
+        level.dropped++;
+        return false;
+    }
+    return true;
+}
 
-    if (result == pdPASS) {
-        return true; // Successfully queued
+bool SerialQueueManager::add_message_to_arena(PriorityLevel& level, SerialMessageHeader header, const char* payload, size_t length) {
+    const size_t FRAGMENT_COUNT = (length == 0) ? 1 : (length + level.maxPayloadPerRecord - 1) / level.maxPayloadPerRecord;
+    if (FRAGMENT_COUNT > MAX_FRAGMENTS) {
+        return false; // Could never be reserved in one piece
     }
+    const TickType_t WAIT_TICKS =
+        (level.dropPolicy == SerialDropPolicy::BLOCK_THEN_DROP_NEWEST) ? pdMS_TO_TICKS(CRITICAL_BLOCK_TIMEOUT_MS) : 0;
 
-    // Queue is full - remove oldest message to make room
-    SerialMessage old_message;
-    if (xQueueReceive(_messageQueue, &old_message, 0) == pdPASS) {
-        // Now try to add the new message
-        result = xQueueSend(_messageQueue, &msg, 0);
-        if (result == pdPASS) {
-            return true;
+    // Producers of one level take turns, so every fragment of a message is reserved before the next message starts
+    xSemaphoreTake(level.writeLock, portMAX_DELAY);
+
+    void* slots[MAX_FRAGMENTS] = {};
+    size_t reserved = 0;
+    size_t offset = 0;
+    uint8_t evictions = 0;
+    while (reserved < FRAGMENT_COUNT) {
+        const size_t CHUNK = std::min(length - offset, level.maxPayloadPerRecord);
+        if (xRingbufferSendAcquire(level.arena, &slots[reserved], sizeof(SerialMessageHeader) + CHUNK, WAIT_TICKS) == pdTRUE &&
+            slots[reserved] != nullptr) {
+            offset += CHUNK;
+            reserved++;
+            continue;
         }
+
+        // Arena is full - evict whole messages of this level only, never another level's
+        if (level.dropPolicy != SerialDropPolicy::DROP_OLDEST || evictions >= MAX_DROP_ATTEMPTS || !evict_oldest_message(level)) {
+            break;
+        }
+        evictions++;
     }
 
-    return false;
-}
+    // Reserved space can't be handed back, so a message that didn't fit entirely leaves its fragments marked
+    // FLAG_DISCARDED for the output task to skip
+    const bool COMPLETE = reserved == FRAGMENT_COUNT;
+    offset = 0;
+    for (size_t i = 0; i < reserved; i++) {
+        const size_t CHUNK = std::min(length - offset, level.maxPayloadPerRecord);
+        SerialMessageHeader fragment = header;
+        if (COMPLETE) {
+            fragment.length = CHUNK;
+            if (i + 1 < reserved) {
+                fragment.flags |= FLAG_CONTINUES;
+            }
+            if (i > 0) {
+                fragment.flags |= FLAG_CONTINUATION;
+            }
+        } else {
+            fragment.length = 0;
+            fragment.flags = FLAG_DISCARDED;
+        }
 
-void SerialQueueManager::serial_output_task() {
-    SerialMessage message;
+        auto* bytes = static_cast<uint8_t*>(slots[i]);
+        memcpy(bytes, &fragment, sizeof(SerialMessageHeader));
+        memcpy(bytes + sizeof(SerialMessageHeader), payload + offset, fragment.length);
+        offset += CHUNK;
+    }
 
-    // Array to hold messages for priority sorting
-    SerialMessage priority_buffer[10]; // Process up to 10 messages at once for priority
-    int buffer_count = 0;
+    // Completed last to first: the arena only hands out records up to the first incomplete one, so the whole
+    // message becomes visible to the output task at once
+    for (size_t i = reserved; i > 0; i--) {
+        xRingbufferSendComplete(level.arena, slots[i - 1]);
+        xSemaphoreGive(_pendingRecords);
+    }
 
-    while (true) {
-        // Wait for at least one message (blocking)
-        if (xQueueReceive(_messageQueue, &message, portMAX_DELAY) == pdPASS) {
-            priority_buffer[0] = message;
-            buffer_count = 1;
-
-            // Check if there are more messages available for batch processing
-            while (buffer_count < 10 && xQueueReceive(_messageQueue, &message, 0) == pdPASS) {
-                priority_buffer[buffer_count] = message;
-                buffer_count++;
+    xSemaphoreGive(level.writeLock);
+    return COMPLETE;
+}
+
+bool SerialQueueManager::evict_oldest_message(PriorityLevel& level) {
+    // Messages are only ever taken whole (see take_highest_priority_message), so the oldest record starts a message
+    bool evicted = false;
+    xSemaphoreTake(level.readLock, portMAX_DELAY);
+    size_t record_size = 0;
+    void* record = xRingbufferReceive(level.arena, &record_size, 0);
+    while (record != nullptr) {
+        SerialMessageHeader header;
+        memcpy(&header, record, sizeof(SerialMessageHeader));
+        vRingbufferReturnItem(level.arena, record);
+        evicted = true;
+        if ((header.flags & FLAG_CONTINUES) == 0) {
+            if ((header.flags & FLAG_DISCARDED) == 0) {
+                level.dropped++; // Discarded fragments were already counted by their producer
             }
+            break;
+        }
+        record = xRingbufferReceive(level.arena, &record_size, 0);
+    }
+    xSemaphoreGive(level.readLock);
+    // The evicted records' semaphore counts are left behind; the output task tolerates spurious wakeups
+    return evicted;
+}
 
-            // Sort by priority (simple bubble sort - good enough for small arrays)
-            for (int i = 0; i < buffer_count - 1; i++) {
-                for (int j = 0; j < buffer_count - i - 1; j++) {
-                    if (static_cast<int>(priority_buffer[j].priority) > static_cast<int>(priority_buffer[j + 1].priority)) {
-                        SerialMessage temp = priority_buffer[j];
-                        priority_buffer[j] = priority_buffer[j + 1];
-                        priority_buffer[j + 1] = temp;
-                    }
-                }
+uint8_t SerialQueueManager::take_highest_priority_message(RingbufHandle_t& source, uint8_t** fragments) {
+    for (auto& level : _levels) {
+        uint8_t count = 0;
+        size_t record_size = 0;
+        xSemaphoreTake(level.readLock, portMAX_DELAY);
+        void* record = xRingbufferReceive(level.arena, &record_size, 0);
+        while (record != nullptr) {
+            fragments[count++] = static_cast<uint8_t*>(record);
+            SerialMessageHeader header;
+            memcpy(&header, record, sizeof(SerialMessageHeader));
+            if ((header.flags & FLAG_CONTINUES) == 0 || count == MAX_FRAGMENTS) {
+                break;
             }
+            record = xRingbufferReceive(level.arena, &record_size, 0);
+        }
+        xSemaphoreGive(level.readLock);
+
+        if (count > 0) {
+            source = level.arena;
+            return count;
+        }
+    }
+    return 0;
+}
+
+void SerialQueueManager::serial_output_task() {
+    while (true) {
+        // Sleep until at least one record has been enqueued somewhere
+        xSemaphoreTake(_pendingRecords, portMAX_DELAY);
+
+        // Strict priority: re-check from CRITICAL down after every message, so a LOW_PRIO flood
+        // can never delay a browser response by more than the message currently being printed. A split message is
+        // taken whole - a higher-priority line printed between its fragments would be merged into its unterminated
+        // line on the host
+        RingbufHandle_t source = nullptr;
+        uint8_t* fragments[MAX_FRAGMENTS];
+        const uint8_t FRAGMENT_COUNT = take_highest_priority_message(source, fragments);
+        if (FRAGMENT_COUNT == 0) {
+            continue; // Count left behind by an evicted record
+        }
 
-            // Process all messages in priority order
-            for (int i = 0; i < buffer_count; i++) {
-                process_message(priority_buffer[i]);
+        for (uint8_t i = 0; i < FRAGMENT_COUNT; i++) {
+            SerialMessageHeader header;
+            memcpy(&header, fragments[i], sizeof(SerialMessageHeader));
+            if ((header.flags & FLAG_DISCARDED) == 0) {
+                process_message(header, reinterpret_cast<const char*>(fragments[i] + sizeof(SerialMessageHeader)));
             }
+            vRingbufferReturnItem(source, fragments[i]);
         }
+
+        report_new_drops();
     }
 }
 
-void SerialQueueManager::process_message(const SerialMessage& msg) {
+void SerialQueueManager::report_new_drops() {
+    for (uint8_t i = 0; i < NUM_PRIORITY_LEVELS; i++) {
+        const uint32_t DROPPED = _levels[i].dropped.load();
+        if (DROPPED == _reportedDrops[i]) {
+            continue;
+        }
+
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "[SerialQueue] %lu %s message(s) dropped (%lu total)",
+                 static_cast<unsigned long>(DROPPED - _reportedDrops[i]), PRIORITY_NAMES[i], static_cast<unsigned long>(DROPPED));
+        _reportedDrops[i] = DROPPED;
+
+        SerialMessageHeader header;
+        header.priority = SerialPriority::NORMAL;
+        header.length = strlen(buffer);
+        process_message(header, buffer);
+    }
+}
+
+void SerialQueueManager::process_message(const SerialMessageHeader& header, const char* payload) {
     const char* priority_str = "";
-    switch (msg.priority) {
+    switch (header.priority) {
         case SerialPriority::CRITICAL:
             priority_str = "[CRIT] ";
             break;
@@ -114,7 +286,20 @@ void SerialQueueManager::process_message(const SerialMessage& msg) {
             break;
     }
 
-    Serial.print(priority_str);
-    Serial.println(msg.message);
+    if ((header.flags & FLAG_CONTINUATION) == 0) {
+        Serial.print(priority_str);
+    }
+
+    if ((header.flags & FLAG_DEFERRED) != 0) {
+        // Expand the deferred record here, on the SerialQueue task, instead of on the producer
+        char line[MAX_DEFERRED_LINE_LENGTH];
+        const size_t LINE_LENGTH = deferred_log::format(reinterpret_cast<const uint8_t*>(payload), header.length, line, sizeof(line));
+        Serial.write(reinterpret_cast<const uint8_t*>(line), LINE_LENGTH);
+    } else {
+        Serial.write(reinterpret_cast<const uint8_t*>(payload), header.length);
+    }
+    if ((header.flags & FLAG_CONTINUES) == 0) {
+        Serial.println();
+    }
     Serial.flush();
 }
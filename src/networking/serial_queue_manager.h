@@ -1,50 +1,106 @@
 #pragma once
 #include <Arduino.h>
 
+#include <atomic>
 #include <freertos/FreeRTOS.h>
-#include <freertos/queue.h>
+#include <freertos/ringbuf.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include "networking/deferred_log.h"
 #include "utils/config.h"
 #include "utils/singleton.h"
 
-enum class SerialPriority {
+enum class SerialPriority : uint8_t {
     CRITICAL = 0,  // Browser command responses, critical errors
     HIGH_PRIO = 1, // Sensor data, connection status, important events
     NORMAL = 2,    // General debug info, state changes
     LOW_PRIO = 3   // Verbose logs, frequent updates
 };
 
-struct SerialMessage {
-    char message[256]{};
-    SerialPriority priority{SerialPriority::NORMAL};
+// What to do when a priority level's arena is full
+enum class SerialDropPolicy : uint8_t {
+    BLOCK_THEN_DROP_NEWEST, // Wait briefly for the output task to free space, then reject the new message
+    DROP_OLDEST,            // Evict the oldest messages of the same level (freshest data wins)
+    DROP_NEWEST             // Reject the new message immediately (cheapest, for verbose logs)
+};
+
+// Fixed-size prefix of every record stored in a message arena. The message bytes follow
+// directly after the header (no null terminator), so a record costs sizeof(header) + length.
+struct SerialMessageHeader {
     uint32_t timestamp{0};
     uint16_t length{0};
-
-    SerialMessage() {
-        message[0] = '\0';
-    }
+    SerialPriority priority{SerialPriority::NORMAL};
+    uint8_t flags{0};
 };
 
 class SerialQueueManager : public Singleton<SerialQueueManager> {
     friend class Singleton<SerialQueueManager>;
 
   public:
+    static constexpr uint8_t NUM_PRIORITY_LEVELS = 4;
+
     void initialize();
     bool queue_message(const String& msg, SerialPriority priority = SerialPriority::LOW_PRIO);
     bool queue_message(const char* msg, SerialPriority priority = SerialPriority::LOW_PRIO);
     void serial_output_task();
 
+    // Deferred-format logging: enqueues the format ID and raw argument words (a few dozen bytes);
+    // the string is only built by the SerialQueue task. Safe to call from hot paths.
+    template <typename... Args> bool log(SerialPriority priority, LogFormat format, Args... args) {
+        static_assert(sizeof...(Args) <= deferred_log::MAX_ARGS, "Too many deferred log arguments");
+        const DeferredLogArg ARGS[sizeof...(Args) + 1] = {DeferredLogArg(args)..., DeferredLogArg()};
+        return enqueue_deferred(format, ARGS, sizeof...(Args), priority);
+    }
+    template <typename... Args> bool log(LogFormat format, Args... args) {
+        return log(SerialPriority::LOW_PRIO, format, args...);
+    }
+
+    uint32_t get_dropped_count(SerialPriority priority) const {
+        return _levels[static_cast<uint8_t>(priority)].dropped.load();
+    }
+
   private:
     SerialQueueManager() = default;
 
-    // Queue configuration
-    static constexpr uint16_t SERIAL_QUEUE_SIZE = 50;
+    struct PriorityLevel {
+        RingbufHandle_t arena = nullptr;
+        SemaphoreHandle_t writeLock = nullptr; // Held by a producer while it reserves all fragments of one message
+        SemaphoreHandle_t readLock = nullptr;  // Makes taking or evicting a whole message atomic
+        size_t maxPayloadPerRecord = 0;
+        SerialDropPolicy dropPolicy = SerialDropPolicy::DROP_OLDEST;
+        std::atomic<uint32_t> dropped{0};
+    };
+
+    static constexpr uint8_t MAX_DROP_ATTEMPTS = 8;
+    static constexpr uint32_t CRITICAL_BLOCK_TIMEOUT_MS = 20;
+    static constexpr uint8_t MAX_FRAGMENTS = 4; // Larger messages can't fit an arena in one piece anyway
+
+    // Messages too large for a single record are split into fragments. FLAG_CONTINUES marks every
+    // fragment except the last, FLAG_CONTINUATION every fragment except the first, so the output task
+    // prints them back to back with a single priority prefix and a single line break. All fragments of
+    // a message are reserved, evicted and taken together, never one at a time
+    static constexpr uint8_t FLAG_CONTINUES = 0x01;
+    static constexpr uint8_t FLAG_CONTINUATION = 0x02;
+    // Payload is a deferred_log record (format ID + raw args) rather than text
+    static constexpr uint8_t FLAG_DEFERRED = 0x04;
+    // Space reserved for a message that didn't fit in full; skipped by the output task
+    static constexpr uint8_t FLAG_DISCARDED = 0x08;
+    static constexpr size_t MAX_DEFERRED_LINE_LENGTH = 192;
+
+    // One arena per SerialPriority, drained strictly highest-priority first
+    PriorityLevel _levels[NUM_PRIORITY_LEVELS];
 
-    // FreeRTOS objects
-    QueueHandle_t _messageQueue = nullptr;
+    // Given once per enqueued record so the output task can sleep while every arena is empty
+    SemaphoreHandle_t _pendingRecords = nullptr;
+    uint32_t _reportedDrops[NUM_PRIORITY_LEVELS]{};
 
     // Helper functions
-    bool add_message_to_queue(const SerialMessage& msg);
-    static void process_message(const SerialMessage& msg);
+    bool enqueue(const char* msg, size_t length, SerialPriority priority);
+    bool enqueue_deferred(LogFormat format, const DeferredLogArg* args, uint8_t arg_count, SerialPriority priority);
+    bool add_message_to_arena(PriorityLevel& level, SerialMessageHeader header, const char* payload, size_t length);
+    bool evict_oldest_message(PriorityLevel& level);
+    uint8_t take_highest_priority_message(RingbufHandle_t& source, uint8_t** fragments);
+    void report_new_drops();
+    static void process_message(const SerialMessageHeader& header, const char* payload);
 };
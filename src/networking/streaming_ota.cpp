@@ -0,0 +1,415 @@
+#include "streaming_ota.h"
+
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <esp_spi_flash.h>
+#include <mbedtls/sha256.h>
+
+#include "rom/miniz.h"
+
+OtaResult StreamingOta::update(WiFiClient& client, const String& url, uint16_t version) {
+    // Every HTTP read (including the header) goes through the read buffer, so it is needed before anything else
+    _readBuffer = static_cast<uint8_t*>(malloc(READ_CHUNK_SIZE));
+    if (_readBuffer == nullptr) {
+        return OtaResult::FAILED;
+    }
+    const OtaResult RESULT = run_update(client, url, version);
+    free_buffers();
+    return RESULT;
+}
+
+OtaResult StreamingOta::run_update(WiFiClient& client, const String& url, uint16_t version) {
+    CompressedImageHeader header{};
+    std::vector<uint32_t> block_offsets;
+    bool not_available = false;
+    if (!fetch_header(client, url, header, block_offsets, not_available)) {
+        return not_available ? OtaResult::NOT_AVAILABLE : OtaResult::FAILED;
+    }
+
+    // Resume only if the saved progress is for this exact image going into this exact partition
+    uint32_t first_block = 0;
+    OtaProgressRecord progress{};
+    if (PreferencesManager::get_instance().get_ota_progress(progress) && progress.version == version &&
+        progress.partitionAddress == _partition->address && progress.blockSize == header.blockSize &&
+        memcmp(progress.imageSha256, header.imageSha256, sizeof(header.imageSha256)) == 0 && progress.blocksCommitted <= header.blockCount) {
+        first_block = progress.blocksCommitted;
+        SerialQueueManager::get_instance().queue_message("OTA: resuming at block " + String(first_block) + "/" + String(header.blockCount));
+    } else {
+        progress = OtaProgressRecord{};
+        progress.version = version;
+        progress.partitionAddress = _partition->address;
+        progress.blockSize = header.blockSize;
+        memcpy(progress.imageSha256, header.imageSha256, sizeof(header.imageSha256));
+    }
+
+    // Packed header fields can't bind to std::min's references
+    const uint32_t IMAGE_SIZE = header.imageSize;
+    const uint32_t BLOCK_SIZE = header.blockSize;
+    const uint32_t BLOCK_COUNT = header.blockCount;
+
+    if (!allocate_buffers(BLOCK_SIZE)) {
+        SerialQueueManager::get_instance().queue_message("OTA: not enough memory for streaming update");
+        return OtaResult::FAILED;
+    }
+
+    for (uint32_t block = first_block; block < BLOCK_COUNT; block++) {
+        const uint32_t BLOCK_START = block * BLOCK_SIZE;
+        const uint32_t BLOCK_LENGTH = std::min(BLOCK_SIZE, IMAGE_SIZE - BLOCK_START);
+
+        bool downloaded = false;
+        for (uint8_t attempt = 0; attempt < MAX_BLOCK_ATTEMPTS && !downloaded; attempt++) {
+            if (!wait_for_wifi()) {
+                break;
+            }
+            downloaded = download_block(client, url, block, block_offsets, BLOCK_LENGTH);
+        }
+        if (!downloaded) {
+            SerialQueueManager::get_instance().queue_message("OTA: interrupted at block " + String(block) + ", will resume");
+            return OtaResult::INTERRUPTED;
+        }
+
+        if (!write_block(BLOCK_START, BLOCK_LENGTH)) {
+            return OtaResult::FAILED;
+        }
+
+        progress.blocksCommitted = block + 1;
+        PreferencesManager::get_instance().store_ota_progress(progress);
+        if (_onProgress) {
+            _onProgress(static_cast<int>(BLOCK_START + BLOCK_LENGTH), static_cast<int>(IMAGE_SIZE));
+        }
+    }
+
+    // Hash what actually landed in flash, which also covers blocks written before a resume
+    uint8_t image_sha256[32];
+    if (!hash_partition(_partition, IMAGE_SIZE, _blockBuffer, BLOCK_SIZE, image_sha256) ||
+        memcmp(image_sha256, header.imageSha256, sizeof(image_sha256)) != 0) {
+        PreferencesManager::get_instance().clear_ota_progress();
+        SerialQueueManager::get_instance().queue_message("OTA: SHA-256 mismatch, image discarded");
+        return OtaResult::FAILED;
+    }
+
+    PreferencesManager::get_instance().clear_ota_progress();
+    if (esp_ota_set_boot_partition(_partition) != ESP_OK) {
+        SerialQueueManager::get_instance().queue_message("OTA: image failed validation");
+        return OtaResult::FAILED;
+    }
+    return OtaResult::OK;
+}
+
+bool StreamingOta::fetch_header(WiFiClient& client, const String& url, CompressedImageHeader& header, std::vector<uint32_t>& block_offsets,
+                                bool& not_available) {
+    size_t header_filled = 0;
+    const int HEADER_STATUS = fetch_range(client, url, 0, sizeof(header), [&](const uint8_t* data, size_t length, bool more) {
+        (void)more;
+        memcpy(reinterpret_cast<uint8_t*>(&header) + header_filled, data, length);
+        header_filled += length;
+        return true;
+    });
+    if (HEADER_STATUS != HTTP_CODE_PARTIAL_CONTENT) {
+        // 404: server has no such image; 200: it ignored the range - either way use the full download
+        not_available = HEADER_STATUS == HTTP_CODE_NOT_FOUND || HEADER_STATUS == HTTP_CODE_OK;
+        return false;
+    }
+
+    _isDelta = header.encoding == COMPRESSED_IMAGE_ENCODING_DELTA;
+    const bool VALID = header.magic == COMPRESSED_IMAGE_MAGIC && header.formatVersion == COMPRESSED_IMAGE_FORMAT_VERSION &&
+                       (header.encoding == COMPRESSED_IMAGE_ENCODING_ZLIB || _isDelta) && header.blockSize > 0 &&
+                       header.blockSize <= MAX_BLOCK_SIZE && header.blockSize % SPI_FLASH_SEC_SIZE == 0 &&
+                       header.blockCount == (static_cast<uint64_t>(header.imageSize) + header.blockSize - 1) / header.blockSize;
+    if (!VALID) {
+        SerialQueueManager::get_instance().queue_message("OTA: unrecognised compressed image header");
+        return false;
+    }
+
+    // imageSize bounds the block table allocated below, so it is checked before anything is sized from it
+    _partition = esp_ota_get_next_update_partition(nullptr);
+    if (_partition == nullptr || header.imageSize > _partition->size) {
+        SerialQueueManager::get_instance().queue_message("OTA: image does not fit the update partition");
+        return false;
+    }
+
+    uint32_t table_start = sizeof(header);
+    if (_isDelta) {
+        DeltaBaseHeader base{};
+        if (!fetch_bytes(client, url, table_start, sizeof(base), &base)) {
+            return false;
+        }
+        if (!matches_running_firmware(base)) {
+            // Built against some other firmware - the full image still works
+            SerialQueueManager::get_instance().queue_message("OTA: delta base does not match the running firmware");
+            not_available = true;
+            return false;
+        }
+        table_start += sizeof(base);
+    }
+
+    block_offsets.assign(header.blockCount + 1, 0);
+    if (!fetch_bytes(client, url, table_start, (header.blockCount + 1) * sizeof(uint32_t), block_offsets.data())) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header.blockCount; i++) {
+        if (block_offsets[i + 1] <= block_offsets[i]) {
+            SerialQueueManager::get_instance().queue_message("OTA: corrupt block table");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StreamingOta::fetch_bytes(WiFiClient& client, const String& url, uint32_t start, uint32_t length, void* destination) {
+    auto* bytes = static_cast<uint8_t*>(destination);
+    size_t filled = 0;
+    const int STATUS = fetch_range(client, url, start, length, [&](const uint8_t* data, size_t chunk_length, bool more) {
+        (void)more;
+        memcpy(bytes + filled, data, chunk_length);
+        filled += chunk_length;
+        return true;
+    });
+    return STATUS == HTTP_CODE_PARTIAL_CONTENT;
+}
+
+bool StreamingOta::matches_running_firmware(const DeltaBaseHeader& base) {
+    _basePartition = esp_ota_get_running_partition();
+    _baseSize = base.baseSize;
+    if (_basePartition == nullptr || _baseSize == 0 || _baseSize > _basePartition->size) {
+        return false;
+    }
+
+    // The partition is larger than the image, so hash exactly the bytes the delta was computed from
+    uint8_t running_sha256[32];
+    return hash_partition(_basePartition, _baseSize, _readBuffer, READ_CHUNK_SIZE, running_sha256) &&
+           memcmp(running_sha256, base.baseSha256, sizeof(running_sha256)) == 0;
+}
+
+bool StreamingOta::download_block(WiFiClient& client, const String& url, uint32_t block, const std::vector<uint32_t>& block_offsets,
+                                  uint32_t block_length) {
+    tinfl_init(static_cast<tinfl_decompressor*>(_inflater));
+    uint8_t* output = _isDelta ? _patchBuffer : _blockBuffer;
+    const size_t CAPACITY = _isDelta ? _patchCapacity : block_length;
+    size_t used = 0;
+    bool done = false;
+
+    const uint32_t START = block_offsets[block];
+    const uint32_t LENGTH = block_offsets[block + 1] - START;
+    const int STATUS = fetch_range(client, url, START, LENGTH, [&](const uint8_t* data, size_t length, bool more) {
+        return inflate_chunk(data, length, more, output, CAPACITY, used, done);
+    });
+    if (STATUS != HTTP_CODE_PARTIAL_CONTENT || !done) {
+        return false;
+    }
+    return _isDelta ? apply_patch(used, block_length) : used == block_length;
+}
+
+bool StreamingOta::inflate_chunk(const uint8_t* data, size_t length, bool more_input, uint8_t* output, size_t capacity, size_t& used,
+                                 bool& done) {
+    auto* inflater = static_cast<tinfl_decompressor*>(_inflater);
+    const uint32_t FLAGS = TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF | (more_input ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+
+    while (length > 0 || !more_input) {
+        size_t in_bytes = length;
+        size_t out_bytes = capacity - used;
+        const tinfl_status STATUS = tinfl_decompress(inflater, data, &in_bytes, output, output + used, &out_bytes, FLAGS);
+        data += in_bytes;
+        length -= in_bytes;
+        used += out_bytes;
+
+        if (STATUS == TINFL_STATUS_DONE) {
+            done = true;
+            return true;
+        }
+        if (STATUS < TINFL_STATUS_DONE || STATUS == TINFL_STATUS_HAS_MORE_OUTPUT) {
+            // Corrupt stream, or it inflates to more than the output buffer holds
+            SerialQueueManager::get_instance().queue_message("OTA: inflate failed (" + String(static_cast<int>(STATUS)) + ")");
+            return false;
+        }
+        if (STATUS == TINFL_STATUS_NEEDS_MORE_INPUT && length == 0) {
+            return more_input; // Wait for the next chunk; running out on the last one means a truncated block
+        }
+    }
+    return true;
+}
+
+bool StreamingOta::apply_patch(size_t patch_length, uint32_t block_length) {
+    const uint8_t* patch = _patchBuffer;
+    size_t position = 0;
+    uint32_t out = 0;
+
+    // Every length comes from the network, so each one is bounds checked before it is used
+    while (position < patch_length) {
+        const uint8_t OP = patch[position++];
+        uint32_t base_offset = 0;
+        uint32_t length = 0;
+        if (OP == DELTA_OP_ADD) {
+            if (patch_length - position < 2 * sizeof(uint32_t)) {
+                break;
+            }
+            memcpy(&base_offset, patch + position, sizeof(uint32_t));
+            memcpy(&length, patch + position + sizeof(uint32_t), sizeof(uint32_t));
+            position += 2 * sizeof(uint32_t);
+        } else if (OP == DELTA_OP_LITERAL) {
+            if (patch_length - position < sizeof(uint32_t)) {
+                break;
+            }
+            memcpy(&length, patch + position, sizeof(uint32_t));
+            position += sizeof(uint32_t);
+        } else {
+            break;
+        }
+
+        if (length > patch_length - position || length > block_length - out ||
+            (OP == DELTA_OP_ADD && (base_offset > _baseSize || length > _baseSize - base_offset))) {
+            break;
+        }
+
+        if (OP == DELTA_OP_LITERAL) {
+            memcpy(_blockBuffer + out, patch + position, length);
+        } else {
+            // Base bytes come straight from the running partition, a read chunk at a time
+            for (uint32_t done = 0; done < length;) {
+                const uint32_t CHUNK = (length - done) < READ_CHUNK_SIZE ? (length - done) : static_cast<uint32_t>(READ_CHUNK_SIZE);
+                if (esp_partition_read(_basePartition, base_offset + done, _readBuffer, CHUNK) != ESP_OK) {
+                    return false;
+                }
+                for (uint32_t i = 0; i < CHUNK; i++) {
+                    _blockBuffer[out + done + i] = static_cast<uint8_t>(_readBuffer[i] + patch[position + done + i]);
+                }
+                done += CHUNK;
+            }
+        }
+        position += length;
+        out += length;
+    }
+
+    if (position != patch_length || out != block_length) {
+        SerialQueueManager::get_instance().queue_message("OTA: malformed delta patch");
+        return false;
+    }
+    return true;
+}
+
+bool StreamingOta::write_block(uint32_t offset, uint32_t length) {
+    // blockSize is sector aligned, so only the last (short) block rounds its erase up
+    const uint32_t ERASE_LENGTH = (length + SPI_FLASH_SEC_SIZE - 1) / SPI_FLASH_SEC_SIZE * SPI_FLASH_SEC_SIZE;
+    if (esp_partition_erase_range(_partition, offset, ERASE_LENGTH) != ESP_OK ||
+        esp_partition_write(_partition, offset, _blockBuffer, length) != ESP_OK) {
+        SerialQueueManager::get_instance().queue_message("OTA: flash write failed at offset " + String(offset));
+        return false;
+    }
+    return true;
+}
+
+bool StreamingOta::hash_partition(const esp_partition_t* partition, uint32_t length, uint8_t* buffer, size_t buffer_size,
+                                  uint8_t sha256[32]) {
+    mbedtls_sha256_context context;
+    mbedtls_sha256_init(&context);
+    mbedtls_sha256_starts_ret(&context, 0);
+
+    for (uint32_t offset = 0; offset < length; offset += buffer_size) {
+        const size_t CHUNK = (length - offset) < buffer_size ? (length - offset) : buffer_size;
+        if (esp_partition_read(partition, offset, buffer, CHUNK) != ESP_OK) {
+            mbedtls_sha256_free(&context);
+            return false;
+        }
+        mbedtls_sha256_update_ret(&context, buffer, CHUNK);
+    }
+
+    mbedtls_sha256_finish_ret(&context, sha256);
+    mbedtls_sha256_free(&context);
+    return true;
+}
+
+bool StreamingOta::wait_for_wifi() {
+    const uint32_t START = millis();
+    while (WiFiClass::status() != WL_CONNECTED) {
+        if (millis() - START >= WIFI_WAIT_TIMEOUT_MS) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(250));
+    }
+    return true;
+}
+
+int StreamingOta::fetch_range(WiFiClient& client, const String& url, uint32_t start, uint32_t length,
+                              const std::function<bool(const uint8_t*, size_t, bool)>& sink) {
+    // Keep-alive, so consecutive blocks don't each pay for a TLS handshake
+    _http.setReuse(true);
+    if (!_http.begin(client, url)) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    _http.setTimeout(READ_TIMEOUT_MS);
+    _http.addHeader("Range", "bytes=" + String(start) + "-" + String(start + length - 1));
+
+    const int STATUS = _http.GET();
+    if (STATUS != HTTP_CODE_PARTIAL_CONTENT) {
+        // Whatever body came with it (a whole image, if the server ignored the range) is still on the socket
+        _http.end();
+        client.stop();
+        return STATUS;
+    }
+
+    WiFiClient* stream = _http.getStreamPtr();
+    uint32_t remaining = length;
+    uint32_t last_data_time = millis();
+    int result = STATUS;
+    while (remaining > 0) {
+        const size_t AVAILABLE = stream->available();
+        if (AVAILABLE == 0) {
+            if (!stream->connected() || millis() - last_data_time >= READ_TIMEOUT_MS) {
+                result = HTTPC_ERROR_READ_TIMEOUT;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(2));
+            continue;
+        }
+
+        size_t want = AVAILABLE < READ_CHUNK_SIZE ? AVAILABLE : static_cast<size_t>(READ_CHUNK_SIZE);
+        if (want > remaining) {
+            want = remaining;
+        }
+        const int READ = stream->read(_readBuffer, want);
+        if (READ <= 0) {
+            continue;
+        }
+        last_data_time = millis();
+        remaining -= READ;
+        if (!sink(_readBuffer, READ, remaining > 0)) {
+            result = HTTPC_ERROR_STREAM_WRITE;
+            break;
+        }
+    }
+
+    _http.end();
+    if (result != STATUS) {
+        client.stop(); // Unread body left on the socket - it can't be reused for the next request
+    }
+    return result;
+}
+
+bool StreamingOta::allocate_buffers(uint32_t block_size) {
+    _blockSize = block_size;
+    _blockBuffer = static_cast<uint8_t*>(heap_caps_malloc(block_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (_blockBuffer == nullptr) {
+        _blockBuffer = static_cast<uint8_t*>(malloc(block_size));
+    }
+    if (_isDelta) {
+        _patchCapacity = block_size + DELTA_PATCH_SLACK;
+        _patchBuffer = static_cast<uint8_t*>(heap_caps_malloc(_patchCapacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if (_patchBuffer == nullptr) {
+            _patchBuffer = static_cast<uint8_t*>(malloc(_patchCapacity));
+        }
+    }
+    _inflater = malloc(sizeof(tinfl_decompressor));
+    return _blockBuffer != nullptr && _inflater != nullptr && (!_isDelta || _patchBuffer != nullptr);
+}
+
+void StreamingOta::free_buffers() {
+    free(_blockBuffer);
+    free(_patchBuffer);
+    free(_readBuffer);
+    free(_inflater);
+    _blockBuffer = nullptr;
+    _patchBuffer = nullptr;
+    _readBuffer = nullptr;
+    _inflater = nullptr;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include <esp_ota_ops.h>
+#include <functional>
+#include <vector>
+
+#include "networking/serial_queue_manager.h"
+#include "utils/preferences_manager.h"
+#include "utils/structs.h"
+
+// Block-compressed firmware image served at get_server_compressed_firmware_endpoint() (full image) and
+// get_server_delta_firmware_endpoint() (patch against the running firmware). All fields little-endian:
+//
+//   CompressedImageHeader
+//   DeltaBaseHeader                         // Delta encoding only
+//   uint32_t blockOffsets[blockCount + 1]   // File offset of each compressed block; the last entry is the file size
+//   compressed blocks                       // Each one an independent zlib stream
+//
+// ZLIB blocks inflate to blockSize image bytes. DELTA blocks inflate to a patch (at most blockSize + DELTA_PATCH_SLACK
+// bytes) of bsdiff-style records that rebuild blockSize image bytes from the running firmware:
+//
+//   DELTA_OP_ADD:     uint32_t baseOffset, uint32_t length, length bytes  -> out[i] = base[baseOffset + i] + diff[i]
+//   DELTA_OP_LITERAL: uint32_t length, length bytes                       -> copied as is
+//
+// Unchanged code makes the diff bytes almost all zero, which is why a compressed patch is a small fraction of the image.
+// Independent blocks are what make the download resumable: any block can be fetched with an HTTP range request and
+// rebuilt on its own, so after an interruption we continue from the last block committed to flash.
+struct __attribute__((packed)) CompressedImageHeader {
+    uint32_t magic;
+    uint8_t formatVersion;
+    uint8_t encoding;
+    uint16_t reserved;
+    uint32_t imageSize; // Uncompressed app image size
+    uint32_t blockSize; // Uncompressed bytes per block (the last block may be shorter)
+    uint32_t blockCount;
+    uint8_t imageSha256[32]; // Of the uncompressed image
+};
+
+// The firmware a delta was computed against. Checked against the running partition before anything is written
+struct __attribute__((packed)) DeltaBaseHeader {
+    uint32_t baseSize;
+    uint8_t baseSha256[32];
+};
+
+constexpr uint32_t COMPRESSED_IMAGE_MAGIC = 0x5A504950; // "PIPZ"
+constexpr uint8_t COMPRESSED_IMAGE_FORMAT_VERSION = 1;
+constexpr uint8_t COMPRESSED_IMAGE_ENCODING_ZLIB = 1;
+constexpr uint8_t COMPRESSED_IMAGE_ENCODING_DELTA = 2;
+
+constexpr uint8_t DELTA_OP_ADD = 1;
+constexpr uint8_t DELTA_OP_LITERAL = 2;
+constexpr uint32_t DELTA_PATCH_SLACK = 4096; // Room for record headers on top of blockSize
+
+enum class OtaResult : uint8_t {
+    OK,            // Image written and verified, boot partition switched - caller should restart
+    NOT_AVAILABLE, // Server has no such image (or no range support) - caller may fall back to a full download
+    INTERRUPTED,   // Download stopped part way; progress is saved and the next attempt resumes
+    FAILED         // Image rejected (bad header, inflate error, hash mismatch)
+};
+
+// Downloads a block-compressed image in HTTP range requests, rebuilds each block (inflating it, and for deltas patching
+// it against the running partition) straight into the inactive OTA partition, verifies the image SHA-256 and switches
+// the boot partition. Progress is committed to PreferencesManager after every block, so a dropped connection (or a
+// reboot) costs at most one block.
+class StreamingOta {
+  public:
+    using ProgressCallback = std::function<void(int, int)>;
+
+    void on_progress(ProgressCallback callback) {
+        _onProgress = callback;
+    }
+
+    // Blocks the calling task for the whole download
+    OtaResult update(WiFiClient& client, const String& url, uint16_t version);
+
+  private:
+    OtaResult run_update(WiFiClient& client, const String& url, uint16_t version);
+    bool fetch_header(WiFiClient& client, const String& url, CompressedImageHeader& header, std::vector<uint32_t>& block_offsets,
+                      bool& not_available);
+    bool fetch_bytes(WiFiClient& client, const String& url, uint32_t start, uint32_t length, void* destination);
+    bool matches_running_firmware(const DeltaBaseHeader& base);
+    bool download_block(WiFiClient& client, const String& url, uint32_t block, const std::vector<uint32_t>& block_offsets,
+                        uint32_t block_length);
+    bool inflate_chunk(const uint8_t* data, size_t length, bool more_input, uint8_t* output, size_t capacity, size_t& used, bool& done);
+    bool apply_patch(size_t patch_length, uint32_t block_length);
+    bool write_block(uint32_t offset, uint32_t length);
+    bool hash_partition(const esp_partition_t* partition, uint32_t length, uint8_t* buffer, size_t buffer_size, uint8_t sha256[32]);
+    bool wait_for_wifi();
+    bool allocate_buffers(uint32_t block_size);
+    void free_buffers();
+
+    // Reads exactly length bytes of [start, start + length) into sink. Returns the HTTP status (206 on success) or
+    // a negative HTTPClient error
+    int fetch_range(WiFiClient& client, const String& url, uint32_t start, uint32_t length,
+                    const std::function<bool(const uint8_t*, size_t, bool)>& sink);
+
+    static constexpr uint32_t MAX_BLOCK_SIZE = 65536;
+    static constexpr size_t READ_CHUNK_SIZE = 2048;
+    static constexpr uint8_t MAX_BLOCK_ATTEMPTS = 5;
+    static constexpr uint32_t WIFI_WAIT_TIMEOUT_MS = 30000; // How long a dropped download waits for WiFi to come back
+    static constexpr uint32_t READ_TIMEOUT_MS = 5000;
+
+    HTTPClient _http;
+    const esp_partition_t* _partition = nullptr;
+    const esp_partition_t* _basePartition = nullptr; // Running firmware, read by delta blocks
+    uint32_t _baseSize = 0;
+    bool _isDelta = false;
+    ProgressCallback _onProgress;
+
+    uint8_t* _blockBuffer = nullptr; // One uncompressed block (PSRAM when available)
+    uint32_t _blockSize = 0;
+    uint8_t* _patchBuffer = nullptr; // Inflated delta patch for one block (delta images only)
+    uint32_t _patchCapacity = 0;
+    uint8_t* _readBuffer = nullptr;
+    void* _inflater = nullptr; // tinfl_decompressor, kept opaque so the ROM header stays out of this one
+};
@@ -0,0 +1,217 @@
+#include "websocket_outbox.h"
+
+namespace {
+struct ChannelConfig {
+    size_t arenaSize;
+    size_t byteBudget; // Below arenaSize so ring buffer header overhead never makes a within-budget send fail
+    bool shedOldest;
+};
+
+// Indexed by WsChannel. Telemetry gets the most room because multizone data arrives as 8 row messages at once
+constexpr ChannelConfig CHANNEL_CONFIG[WS_CHANNEL_COUNT] = {
+    {1024, 768, false},  // CONTROL
+    {2048, 1536, false}, // COMMAND
+    {4096, 3072, true}   // TELEMETRY
+};
+
+// Exponentially weighted moving average with alpha = 1/8
+uint32_t smooth(uint32_t average, uint32_t sample) {
+    if (average == 0) {
+        return sample;
+    }
+    return average - (average >> 3) + (sample >> 3);
+}
+} // namespace
+
+void WebSocketOutbox::initialize(bool with_channel_header) {
+    _withChannelHeader = with_channel_header;
+}
+
+void WebSocketOutbox::enable_channel(WsChannel channel) {
+    const auto CHANNEL_INDEX = static_cast<uint8_t>(channel);
+    ChannelQueue& queue = _channels[CHANNEL_INDEX];
+    if (queue.arena != nullptr) {
+        return;
+    }
+
+    // No-split so each record is contiguous and can be handed to the client in place
+    if (queue.writeLock == nullptr) {
+        queue.writeLock = xSemaphoreCreateMutex();
+    }
+    if (queue.writeLock == nullptr) {
+        Serial.println("ERROR: Failed to create WebSocket outbox lock!");
+        return;
+    }
+    queue.arena = xRingbufferCreate(CHANNEL_CONFIG[CHANNEL_INDEX].arenaSize, RINGBUF_TYPE_NOSPLIT);
+    if (queue.arena == nullptr) {
+        Serial.println("ERROR: Failed to create WebSocket outbox arena!");
+        return;
+    }
+    queue.byteBudget = CHANNEL_CONFIG[CHANNEL_INDEX].byteBudget;
+    queue.shedOldest = CHANNEL_CONFIG[CHANNEL_INDEX].shedOldest;
+}
+
+bool WebSocketOutbox::enqueue(WsChannel channel, const char* data, size_t length) {
+    const auto CHANNEL_INDEX = static_cast<uint8_t>(channel);
+    if (data == nullptr || CHANNEL_INDEX >= WS_CHANNEL_COUNT || _channels[CHANNEL_INDEX].arena == nullptr) {
+        return false;
+    }
+
+    ChannelQueue& queue = _channels[CHANNEL_INDEX];
+    xSemaphoreTake(queue.writeLock, portMAX_DELAY);
+    const bool ACCEPTED = push_record(queue, CHANNEL_INDEX, data, length);
+    xSemaphoreGive(queue.writeLock);
+    return ACCEPTED;
+}
+
+// Caller holds queue.writeLock, so no other producer can fill the room this one just checked for or evicted.
+// The drain task only ever lowers queuedBytes, which leaves the check conservative.
+bool WebSocketOutbox::push_record(ChannelQueue& queue, uint8_t channel_index, const char* data, size_t length) {
+    const size_t RECORD_SIZE = WS_CHANNEL_HEADER_SIZE + length;
+    if (RECORD_SIZE > queue.byteBudget) {
+        queue.dropped++;
+        return false;
+    }
+
+    // Over budget: telemetry makes room by shedding its stalest records, everything else is refused
+    while (queue.queuedBytes.load() + RECORD_SIZE > queue.byteBudget) {
+        if (!queue.shedOldest || !evict_oldest(queue)) {
+            queue.dropped++;
+            return false;
+        }
+    }
+
+    void* slot = nullptr;
+    if (xRingbufferSendAcquire(queue.arena, &slot, RECORD_SIZE, 0) != pdTRUE || slot == nullptr) {
+        queue.dropped++;
+        return false;
+    }
+
+    auto* bytes = static_cast<uint8_t*>(slot);
+    bytes[0] = channel_index;
+    memcpy(bytes + WS_CHANNEL_HEADER_SIZE, data, length);
+    queue.queuedBytes += RECORD_SIZE; // Counted before the record becomes visible so the drain side can never underflow it
+    xRingbufferSendComplete(queue.arena, slot);
+    return true;
+}
+
+bool WebSocketOutbox::evict_oldest(ChannelQueue& queue) {
+    size_t record_size = 0;
+    void* record = xRingbufferReceive(queue.arena, &record_size, 0);
+    if (record == nullptr) {
+        return false;
+    }
+    vRingbufferReturnItem(queue.arena, record);
+    queue.queuedBytes -= record_size;
+    queue.dropped++;
+    return true;
+}
+
+uint8_t WebSocketOutbox::drain(websockets::WebsocketsClient& client, uint8_t max_messages) {
+    uint8_t sent = 0;
+    while (sent < max_messages) {
+        // Re-scan from the highest priority after every send so a new command pre-empts queued telemetry
+        void* record = nullptr;
+        size_t record_size = 0;
+        ChannelQueue* source = nullptr;
+        for (ChannelQueue& queue : _channels) {
+            if (queue.arena == nullptr) {
+                continue;
+            }
+            record = xRingbufferReceive(queue.arena, &record_size, 0);
+            if (record != nullptr) {
+                source = &queue;
+                break;
+            }
+        }
+        if (source == nullptr) {
+            break;
+        }
+
+        const uint32_t SEND_START = micros();
+        const auto* bytes = static_cast<const char*>(record);
+        if (_withChannelHeader) {
+            client.sendBinary(bytes, record_size);
+        } else {
+            client.send(bytes + WS_CHANNEL_HEADER_SIZE, record_size - WS_CHANNEL_HEADER_SIZE);
+        }
+        const uint32_t ELAPSED = micros() - SEND_START;
+
+        vRingbufferReturnItem(source->arena, record);
+        source->queuedBytes -= record_size;
+        record_send(record_size, ELAPSED);
+        sent++;
+
+        // TCP is backing up - stop here so the owning task gets back to polling (and receiving commands)
+        if (ELAPSED >= SLOW_SEND_MICROS) {
+            break;
+        }
+    }
+
+    update_telemetry_downsample();
+    return sent;
+}
+
+void WebSocketOutbox::record_send(size_t bytes, uint32_t elapsed_micros) {
+    _avgSendMicros = smooth(_avgSendMicros.load(), elapsed_micros);
+
+    // Throughput over ~1s windows, smoothed across windows
+    _windowBytes += bytes;
+    const uint32_t WINDOW_MS = millis() - _windowStart;
+    if (WINDOW_MS >= THROUGHPUT_WINDOW_MS) {
+        const auto WINDOW_RATE = static_cast<uint32_t>((static_cast<uint64_t>(_windowBytes) * 1000) / WINDOW_MS);
+        _throughputBytesSec = smooth(_throughputBytesSec.load(), WINDOW_RATE);
+        _windowStart = millis();
+        _windowBytes = 0;
+    }
+}
+
+void WebSocketOutbox::update_telemetry_downsample() {
+    const ChannelQueue& telemetry = _channels[static_cast<uint8_t>(WsChannel::TELEMETRY)];
+    if (telemetry.arena == nullptr || millis() - _lastDownsampleChange < DOWNSAMPLE_HOLD_MS) {
+        return;
+    }
+
+    const uint32_t QUEUED = telemetry.queuedBytes.load();
+    const uint32_t AVG_SEND = _avgSendMicros.load();
+    const uint8_t CURRENT = _telemetryDownsample.load();
+
+    const bool CONGESTED = AVG_SEND > CONGESTED_SEND_MICROS || QUEUED > telemetry.byteBudget / 2;
+    const bool HEALTHY = AVG_SEND < HEALTHY_SEND_MICROS && QUEUED < telemetry.byteBudget / 8;
+
+    uint8_t next = CURRENT;
+    if (CONGESTED && CURRENT < MAX_TELEMETRY_DOWNSAMPLE) {
+        next = CURRENT * 2;
+    } else if (HEALTHY && CURRENT > 1) {
+        next = CURRENT / 2;
+    }
+    if (next != CURRENT) {
+        _telemetryDownsample = next;
+        _lastDownsampleChange = millis();
+    }
+}
+
+void WebSocketOutbox::clear() {
+    for (ChannelQueue& queue : _channels) {
+        if (queue.arena == nullptr) {
+            continue;
+        }
+        size_t record_size = 0;
+        void* record = nullptr;
+        while ((record = xRingbufferReceive(queue.arena, &record_size, 0)) != nullptr) {
+            vRingbufferReturnItem(queue.arena, record);
+            queue.queuedBytes -= record_size;
+        }
+    }
+}
+
+WsLinkStats WebSocketOutbox::get_link_stats() const {
+    const ChannelQueue& telemetry = _channels[static_cast<uint8_t>(WsChannel::TELEMETRY)];
+    WsLinkStats stats{};
+    stats.avgSendMicros = _avgSendMicros.load();
+    stats.throughputBytesSec = _throughputBytesSec.load();
+    stats.telemetryQueuedBytes = telemetry.queuedBytes.load();
+    stats.telemetryShed = telemetry.dropped.load();
+    stats.telemetryDownsample = _telemetryDownsample.load();
+    return stats;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <ArduinoWebsockets.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/ringbuf.h>
+#include <freertos/semphr.h>
+
+// Logical channels carried over the single multiplexed WebSocket. Every message in mux mode starts with
+// a one-byte channel ID (WS_CHANNEL_HEADER_SIZE) followed by the unchanged command frame / JSON payload.
+// Lower IDs are drained first, so acks and commands always go out ahead of telemetry.
+enum class WsChannel : uint8_t { CONTROL = 0, COMMAND = 1, TELEMETRY = 2 };
+
+constexpr uint8_t WS_CHANNEL_COUNT = 3;
+constexpr uint8_t WS_CHANNEL_HEADER_SIZE = 1;
+
+// Snapshot of how the link is coping, for logging and adaptive telemetry rates
+struct WsLinkStats {
+    uint32_t avgSendMicros;      // Smoothed time spent inside one client send (grows when TCP backs up)
+    uint32_t throughputBytesSec; // Smoothed bytes/s actually pushed into the socket
+    uint32_t telemetryQueuedBytes;
+    uint32_t telemetryShed; // Telemetry records evicted/dropped since boot
+    uint8_t telemetryDownsample;
+};
+
+// Outbound queue for a WebSocket connection. Any task may enqueue; only the task that owns the
+// WebsocketsClient drains, so the (non thread-safe) client is never touched concurrently and a slow
+// send stalls the drain loop instead of the producer.
+//
+// Each channel has a byte budget. Telemetry is shed oldest-first when over budget (a newer sample replaces
+// a stale one), while control/command messages are only refused when their own budget is exhausted.
+class WebSocketOutbox {
+  public:
+    // with_channel_header: multiplexed connection (binary records prefixed by channel ID). Otherwise records are sent as
+    // plain text frames. Only channels passed to enable_channel() get an arena.
+    void initialize(bool with_channel_header);
+    void enable_channel(WsChannel channel);
+
+    // Copies the message into the channel's arena. Returns false if it was refused
+    bool enqueue(WsChannel channel, const char* data, size_t length);
+
+    // Sends up to max_messages records in strict channel priority. Returns how many were sent
+    uint8_t drain(websockets::WebsocketsClient& client, uint8_t max_messages);
+
+    // Drops everything still queued (used when the connection closes - stale commands/telemetry are not replayed)
+    void clear();
+
+    // 1 = full rate; 2, 4, 8 = producers should send telemetry that many times less often
+    uint8_t get_telemetry_downsample() const {
+        return _telemetryDownsample.load();
+    }
+
+    uint32_t get_dropped_count(WsChannel channel) const {
+        return _channels[static_cast<uint8_t>(channel)].dropped.load();
+    }
+
+    WsLinkStats get_link_stats() const;
+
+  private:
+    struct ChannelQueue {
+        RingbufHandle_t arena = nullptr;
+        SemaphoreHandle_t writeLock = nullptr; // Held by a producer across the budget check, eviction and push
+        size_t byteBudget = 0;
+        bool shedOldest = false;
+        std::atomic<uint32_t> queuedBytes{0};
+        std::atomic<uint32_t> dropped{0};
+    };
+
+    bool push_record(ChannelQueue& queue, uint8_t channel_index, const char* data, size_t length);
+    bool evict_oldest(ChannelQueue& queue);
+    void record_send(size_t bytes, uint32_t elapsed_micros);
+    void update_telemetry_downsample();
+
+    ChannelQueue _channels[WS_CHANNEL_COUNT];
+    bool _withChannelHeader = false;
+
+    // Written only by the draining task
+    std::atomic<uint32_t> _avgSendMicros{0};
+    std::atomic<uint32_t> _throughputBytesSec{0};
+    std::atomic<uint8_t> _telemetryDownsample{1};
+    uint32_t _lastDownsampleChange = 0;
+    uint32_t _windowStart = 0;
+    uint32_t _windowBytes = 0;
+
+    static constexpr uint8_t MAX_TELEMETRY_DOWNSAMPLE = 8;
+    static constexpr uint32_t SLOW_SEND_MICROS = 20000;    // A send this slow means TCP is backing up - yield to commands
+    static constexpr uint32_t CONGESTED_SEND_MICROS = 8000; // Smoothed send time above this halves the telemetry rate
+    static constexpr uint32_t HEALTHY_SEND_MICROS = 2000;   // ...and below this (with a near-empty queue) doubles it back
+    static constexpr uint32_t DOWNSAMPLE_HOLD_MS = 500;     // Minimum time between rate changes
+    static constexpr uint32_t THROUGHPUT_WINDOW_MS = 1000;
+};
@@ -17,11 +17,14 @@ WiFiManager::WiFiManager() {
 }
 
 void WiFiManager::connect_to_stored_wifi() {
+    _bootTiming.wifiStartMs = millis();
     const bool CONNECTION_STATUS = attempt_direct_connection_to_saved_networks();
 
     if (!CONNECTION_STATUS) {
         start_async_scan();
     } else {
+        _bootTiming.wifiConnectedMs = millis();
+        _bootTiming.usedFastConnect = _lastConnectWasFast;
         // Connect BOTH websocket managers
         SensorWebSocketManager::get_instance().connect_to_websocket();  // NEW
         CommandWebSocketManager::get_instance().connect_to_websocket(); // CHANGED
@@ -36,6 +39,11 @@ bool WiFiManager::attempt_direct_connection_to_saved_networks() {
         return false;
     }
 
+    // Common case: same AP as last time - skip the scan and DHCP entirely
+    if (attempt_fast_reconnect()) {
+        return true;
+    }
+
     // Get all saved networks
     std::vector<WiFiCredentials> saved_networks = PreferencesManager::get_instance().get_all_stored_wifi_networks();
 
@@ -52,6 +60,72 @@ bool WiFiManager::attempt_direct_connection_to_saved_networks() {
     return false;
 }
 
+bool WiFiManager::attempt_fast_reconnect() {
+    PreferencesManager& preferences = PreferencesManager::get_instance();
+    const String LAST_SSID = preferences.get_last_connected_ssid();
+    WiFiFastConnectRecord record{};
+    if (LAST_SSID.isEmpty() || !preferences.get_wifi_fast_connect(LAST_SSID, record)) {
+        return false;
+    }
+
+    String password;
+    bool is_saved = false;
+    for (const WiFiCredentials& network : preferences.get_all_stored_wifi_networks()) {
+        if (network.ssid == LAST_SSID) {
+            password = network.password;
+            is_saved = true;
+            break;
+        }
+    }
+    if (!is_saved) {
+        return false;
+    }
+
+    SerialQueueManager::get_instance().queue_message("Fast reconnect to " + LAST_SSID + " on channel " + String(record.channel));
+    _isConnecting = true;
+    WiFiClass::mode(WIFI_STA);
+
+    // Join the cached AP directly instead of scanning all channels. The address still comes from DHCP: a cached lease
+    // can't be aged across a power cycle (no clock survives it), and reusing an expired one risks an address conflict
+    WiFi.begin(LAST_SSID.c_str(), password.c_str(), record.channel, record.bssid);
+
+    const uint32_t START_ATTEMPT_TIME = millis();
+    while (WiFiClass::status() != WL_CONNECTED && (millis() - START_ATTEMPT_TIME < FAST_CONNECT_TIMEOUT)) {
+        vTaskDelay(pdMS_TO_TICKS(FAST_CONNECT_POLL_MS));
+    }
+    _isConnecting = false;
+
+    if (WiFiClass::status() == WL_CONNECTED) {
+        _lastConnectWasFast = true;
+        SerialQueueManager::get_instance().queue_message("Fast reconnect succeeded in " + String(millis() - START_ATTEMPT_TIME) + "ms");
+        return true;
+    }
+
+    // Only drop the record when the AP itself turned it down - not found on the cached BSSID/channel, or the
+    // credentials were rejected. A plain timeout (busy AP, slow DHCP) keeps it for next time. The regular path caches
+    // a fresh record when it succeeds
+    const wl_status_t STATUS = WiFiClass::status();
+    SerialQueueManager::get_instance().queue_message("Fast reconnect failed (status " + String(static_cast<int>(STATUS)) +
+                                                     "), falling back to regular connect");
+    WiFi.disconnect();
+    if (STATUS == WL_NO_SSID_AVAIL || STATUS == WL_CONNECT_FAILED) {
+        preferences.clear_wifi_fast_connect(LAST_SSID);
+    }
+    return false;
+}
+
+void WiFiManager::cache_fast_connect_record(const String& ssid) {
+    const uint8_t* bssid = WiFi.BSSID();
+    if (bssid == nullptr) {
+        return;
+    }
+
+    WiFiFastConnectRecord record{};
+    memcpy(record.bssid, bssid, sizeof(record.bssid));
+    record.channel = WiFi.channel();
+    PreferencesManager::get_instance().store_wifi_fast_connect(ssid, record);
+}
+
 bool WiFiManager::attempt_new_wifi_connection(const WiFiCredentials& wifi_credentials) {
     // Set WiFi mode to Station (client mode)
     _isConnecting = true;
@@ -90,6 +164,8 @@ bool WiFiManager::attempt_new_wifi_connection(const WiFiCredentials& wifi_creden
 
     if (WiFiClass::status() == WL_CONNECTED) {
         store_wifi_credentials(wifi_credentials.ssid, wifi_credentials.password, 0);
+        cache_fast_connect_record(wifi_credentials.ssid);
+        _lastConnectWasFast = false;
         SerialQueueManager::get_instance().queue_message("Connected to Wi-Fi!");
         return true;
     } else {
@@ -98,11 +174,6 @@ bool WiFiManager::attempt_new_wifi_connection(const WiFiCredentials& wifi_creden
     }
 }
 
-void WiFiManager::sort_networks_by_signal_strength(std::vector<WiFiNetworkInfo>& networks) {
-    // Sort networks by RSSI (higher values = stronger signal)
-    std::sort(networks.begin(), networks.end(), [](const WiFiNetworkInfo& a, const WiFiNetworkInfo& b) { return a.rssi > b.rssi; });
-}
-
 // For storing WiFi credentials:
 void WiFiManager::store_wifi_credentials(const String& ssid, const String& password, int index) {
     PreferencesManager::get_instance().store_wifi_credentials(ssid, password, index);
@@ -191,6 +262,7 @@ void WiFiManager::process_wifi_credential_test() {
 
         if (command_ws_connected && sensor_ws_connected) {
             store_wifi_credentials(_testSSID, _testPassword, 0);
+            cache_fast_connect_record(_testSSID);
             SerialManager::get_instance().send_json_message(ToSerialMessage::WIFI_CONNECTION_RESULT, "success");
         } else {
             WiFi.setAutoReconnect(false);
@@ -289,32 +361,44 @@ bool WiFiManager::start_async_scan() {
 
     SerialQueueManager::get_instance().queue_message("Starting async WiFi scan...");
 
-    // Clear any previous scan results
-    _availableNetworks.clear();
-
     // Prepare WiFi for scanning
     WiFi.disconnect(true);
     WiFi.scanDelete();
     vTaskDelay(pdMS_TO_TICKS(100));
     WiFiClass::mode(WIFI_STA);
 
-    // Start async scan
-    const int16_t RESULT = WiFi.scanNetworks(true); // true = async
-
-    if (RESULT == WIFI_SCAN_RUNNING) {
-        _asyncScanInProgress = true;
-        _asyncScanStartTime = millis();
-        SerialQueueManager::get_instance().queue_message("Async scan initiated successfully");
-
-        // Send scan started message to browser
-        SerialManager::get_instance().send_scan_started_message();
-
-        return true;
+    // Sweep the channels allowed in the configured country one at a time
+    wifi_country_t country{};
+    if (esp_wifi_get_country(&country) == ESP_OK && country.nchan > 0) {
+        _scanChannel = country.schan;
+        _scanLastChannel = country.schan + country.nchan - 1;
     } else {
+        _scanChannel = 1;
+        _scanLastChannel = 11;
+    }
+    _scanMissedChannel = false;
+    _scanTable.begin_scan();
+
+    if (!start_channel_scan()) {
         SerialQueueManager::get_instance().queue_message("Failed to start async scan");
         rgb_led.turn_main_board_leds_off();
         return false;
     }
+
+    _asyncScanInProgress = true;
+    _asyncScanStartTime = millis();
+    SerialQueueManager::get_instance().queue_message("Async scan initiated successfully");
+
+    // Send scan started message to browser
+    SerialManager::get_instance().send_scan_started_message();
+
+    return true;
+}
+
+bool WiFiManager::start_channel_scan() {
+    _channelScanStartTime = millis();
+    const int16_t RESULT = WiFi.scanNetworks(true, false, false, SCAN_MS_PER_CHANNEL, _scanChannel); // true = async
+    return RESULT == WIFI_SCAN_RUNNING;
 }
 
 void WiFiManager::check_async_scan_progress() {
@@ -324,24 +408,18 @@ void WiFiManager::check_async_scan_progress() {
 
     const uint32_t CURRENT_TIME = millis();
     const uint32_t SCAN_DURATION = CURRENT_TIME - _asyncScanStartTime;
+    const uint32_t CHANNEL_DURATION = CURRENT_TIME - _channelScanStartTime;
 
     // Don't check status too soon - give the scan time to actually start
-    if (SCAN_DURATION < ASYNC_SCAN_MIN_CHECK_DELAY) {
+    if (CHANNEL_DURATION < CHANNEL_SCAN_MIN_CHECK_DELAY) {
         return; // Too early to check
     }
 
-    // Check for timeout
+    // Check for timeout - report whatever the finished channels found
     if (SCAN_DURATION > ASYNC_SCAN_TIMEOUT_MS) {
         SerialQueueManager::get_instance().queue_message("Async WiFi scan timed out after " + String(SCAN_DURATION) + "ms");
-        _asyncScanInProgress = false;
-        rgb_led.turn_main_board_leds_off();
-
-        // Clean up any scan results
         WiFi.scanDelete();
-
-        // Send empty scan complete message to browser to indicate timeout
-        std::vector<WiFiNetworkInfo> empty_networks;
-        SerialManager::get_instance().send_scan_results_response(empty_networks);
+        finish_async_scan(false);
         return;
     }
 
@@ -351,37 +429,53 @@ void WiFiManager::check_async_scan_progress() {
     // For WIFI_SCAN_RUNNING (-1) and WIFI_SCAN_FAILED (-2), just keep waiting until timeout
     // The ESP32 WiFi library seems to return WIFI_SCAN_FAILED sometimes even when scan is progressing
     if (SCAN_RESULT < 0) {
+        if (CHANNEL_DURATION <= CHANNEL_SCAN_TIMEOUT_MS) {
+            return;
+        }
+        _scanMissedChannel = true; // Give up on this channel, the sweep is no longer complete
+    } else {
+        merge_channel_results(SCAN_RESULT);
+    }
+
+    // Clean up scan results to free memory
+    WiFi.scanDelete();
+
+    if (_scanChannel >= _scanLastChannel) {
+        SerialQueueManager::get_instance().queue_message("Async WiFi scan completed in " + String(SCAN_DURATION) + "ms. " +
+                                                         String(_scanTable.size()) + " networks known");
+        finish_async_scan(!_scanMissedChannel);
         return;
     }
-    // Only handle completion (positive numbers) - ignore WIFI_SCAN_FAILED and WIFI_SCAN_RUNNING
-    // Scan completed successfully
-    SerialQueueManager::get_instance().queue_message("Async WiFi scan completed in " + String(SCAN_DURATION) + "ms. Found " + String(SCAN_RESULT) +
-                                                     " networks");
-    _asyncScanInProgress = false;
-    rgb_led.turn_main_board_leds_off();
-    _lastScanCompleteTime = millis();
-    // Process scan results
-    std::vector<WiFiNetworkInfo> networks;
 
-    for (int i = 0; i < SCAN_RESULT; i++) {
-        WiFiNetworkInfo network;
-        network.ssid = WiFi.SSID(i);
-        network.rssi = WiFi.RSSI(i);
-        network.encryptionType = WiFi.encryptionType(i);
-        networks.push_back(network);
+    _scanChannel++;
+    if (!start_channel_scan()) {
+        SerialQueueManager::get_instance().queue_message("Failed to continue async scan on channel " + String(_scanChannel));
+        finish_async_scan(false);
     }
+}
 
-    // Sort networks by signal strength
-    sort_networks_by_signal_strength(networks);
+void WiFiManager::merge_channel_results(int16_t result_count) {
+    std::vector<WiFiScanDiff> diffs;
+    for (int16_t i = 0; i < result_count; i++) {
+        _scanTable.observe(WiFi.SSID(i), WiFi.RSSI(i), WiFi.encryptionType(i), diffs);
+    }
 
-    // Update class members
-    _availableNetworks = networks;
+    // Stream what this channel changed right away so the setup UI fills in while the sweep continues
+    SerialManager::get_instance().send_scan_diffs(diffs);
+}
 
-    // Clean up scan results to free memory
-    WiFi.scanDelete();
+void WiFiManager::finish_async_scan(bool complete) {
+    _asyncScanInProgress = false;
+    rgb_led.turn_main_board_leds_off();
+    _lastScanCompleteTime = millis();
+
+    // Networks missing from repeated complete sweeps have gone away
+    std::vector<WiFiScanDiff> diffs;
+    _scanTable.end_scan(complete, diffs);
+    SerialManager::get_instance().send_scan_diffs(diffs);
 
-    // Send results to browser
-    SerialManager::get_instance().send_scan_results_response(networks);
+    _availableNetworks = _scanTable.snapshot();
+    SerialManager::get_instance().send_scan_complete_message(_availableNetworks.size());
 }
 
 void WiFiManager::clear_networks_if_stale() {
@@ -390,9 +484,28 @@ void WiFiManager::clear_networks_if_stale() {
         return;
     }
     _availableNetworks.clear();
+    _scanTable.clear();
     SerialQueueManager::get_instance().queue_message("WiFi scan results cleared (stale > 30 min)");
 }
 
 bool WiFiManager::is_connected_to_ssid(const String& ssid) {
     return WiFiClass::status() == WL_CONNECTED && WiFi.SSID() == ssid;
 }
+
+void WiFiManager::report_boot_timing() {
+    if (_bootTiming.reported) {
+        return;
+    }
+    _bootTiming.reported = true;
+
+    // Only meaningful when the boot-time connect succeeded (not after a scan and manual credential entry)
+    if (_bootTiming.wifiConnectedMs == 0) {
+        return;
+    }
+
+    const uint32_t NOW = millis();
+    SerialQueueManager::get_instance().queue_message(
+        "Boot timing - WiFi start: " + String(_bootTiming.wifiStartMs) + "ms, WiFi connect: " +
+        String(_bootTiming.wifiConnectedMs - _bootTiming.wifiStartMs) + "ms (" + (_bootTiming.usedFastConnect ? "cached AP" : "regular") +
+        "), WebSocket: " + String(NOW - _bootTiming.wifiConnectedMs) + "ms, boot to WebSocket: " + String(NOW) + "ms");
+}
@@ -13,6 +13,7 @@
 #include "utils/config.h"
 #include "utils/singleton.h"
 #include "utils/structs.h"
+#include "wifi_scan_table.h"
 
 class WiFiManager : public Singleton<WiFiManager> {
     friend class Singleton<WiFiManager>;
@@ -47,23 +48,42 @@ class WiFiManager : public Singleton<WiFiManager> {
     }
     static bool is_connected_to_ssid(const String& ssid);
 
+    // Logs boot-to-WebSocket timings once, when the command WebSocket first connects
+    void report_boot_timing();
+
   private:
     WiFiManager();
 
     void connect_to_stored_wifi();
     bool attempt_new_wifi_connection(const WiFiCredentials& wifi_credentials);
 
-    // std::vector<WiFiNetworkInfo> scanWiFiNetworkInfos();
-    void sort_networks_by_signal_strength(std::vector<WiFiNetworkInfo>& networks);
+    // Scans run one channel at a time so results (as diffs against _scanTable) can be streamed while scanning
+    bool start_channel_scan();
+    void merge_channel_results(int16_t result_count);
+    void finish_async_scan(bool complete);
 
-    std::vector<WiFiNetworkInfo> _availableNetworks{};
+    WiFiScanTable _scanTable;
+    std::vector<WiFiNetworkInfo> _availableNetworks{}; // Sorted snapshot of _scanTable, refreshed after every scan
 
     bool attempt_direct_connection_to_saved_networks();
+    bool attempt_fast_reconnect();
+    static void cache_fast_connect_record(const String& ssid);
     uint32_t _lastReconnectAttempt = 0;
     bool _isConnecting = false;
     static constexpr uint32_t WIFI_RECONNECT_TIMEOUT = 3000; // 3 second timeout
 
     const uint32_t CONNECT_TO_SINGLE_NETWORK_TIMEOUT = 5000; // 5-second timeout
+    static constexpr uint32_t FAST_CONNECT_TIMEOUT = 3000;   // Directed connect plus DHCP, normally well under a second
+    static constexpr uint32_t FAST_CONNECT_POLL_MS = 10;
+
+    struct BootTiming {
+        uint32_t wifiStartMs = 0; // millis() when WiFiManager started connecting
+        uint32_t wifiConnectedMs = 0;
+        bool usedFastConnect = false;
+        bool reported = false;
+    };
+    BootTiming _bootTiming;
+    bool _lastConnectWasFast = false;
 
     const uint32_t PRINT_INTERVAL = 100; // Print dots every 100ms
     const uint32_t CHECK_INTERVAL = 500; // Check serial every 500ms
@@ -75,8 +95,14 @@ class WiFiManager : public Singleton<WiFiManager> {
     String _testPassword = "";
     bool _asyncScanInProgress = false;
     uint32_t _asyncScanStartTime = 0;
-    static constexpr uint32_t ASYNC_SCAN_TIMEOUT_MS = 10000;    // 10 seconds
-    static constexpr uint32_t ASYNC_SCAN_MIN_CHECK_DELAY = 500; // Don't check status for first 500ms
+    uint32_t _channelScanStartTime = 0;
+    uint8_t _scanChannel = 0;
+    uint8_t _scanLastChannel = 0;
+    bool _scanMissedChannel = false;
+    static constexpr uint32_t ASYNC_SCAN_TIMEOUT_MS = 10000;      // 10 seconds for the whole sweep
+    static constexpr uint32_t CHANNEL_SCAN_TIMEOUT_MS = 1500;     // Skip a channel that never reports
+    static constexpr uint32_t CHANNEL_SCAN_MIN_CHECK_DELAY = 100; // Don't check status right after starting a channel
+    static constexpr uint32_t SCAN_MS_PER_CHANNEL = 300;          // Same dwell as a full WiFi.scanNetworks() sweep
     uint32_t _lastScanCompleteTime = 0;
     static constexpr uint32_t STALE_SCAN_TIMEOUT_MS = 1800000; // 30 minutes
 };
@@ -0,0 +1,82 @@
+#include "wifi_scan_table.h"
+
+#include <algorithm>
+
+void WiFiScanTable::begin_scan() {
+    for (Entry& entry : _entries) {
+        entry.rssiBeforeScan = entry.network.rssi;
+        entry.seenThisScan = false;
+    }
+}
+
+WiFiScanTable::Entry* WiFiScanTable::find(const String& ssid) {
+    for (Entry& entry : _entries) {
+        if (entry.network.ssid == ssid) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void WiFiScanTable::observe(const String& ssid, int32_t rssi, uint8_t encryption_type, std::vector<WiFiScanDiff>& diffs) {
+    if (ssid.isEmpty()) {
+        return; // Hidden networks can't be joined from the setup UI
+    }
+
+    Entry* entry = find(ssid);
+    if (entry == nullptr) {
+        Entry new_entry{};
+        new_entry.network.ssid = ssid;
+        new_entry.network.rssi = rssi;
+        new_entry.network.encryptionType = encryption_type;
+        new_entry.rssiBeforeScan = rssi;
+        new_entry.strongestThisScan = rssi;
+        new_entry.reportedRssi = rssi;
+        new_entry.seenThisScan = true;
+        _entries.push_back(new_entry);
+        diffs.push_back({WiFiScanChange::ADDED, new_entry.network});
+        return;
+    }
+
+    // Several BSSIDs (mesh nodes, 2.4 GHz repeaters) share one SSID - keep the strongest seen during this scan,
+    // and blend it with the previous scans' value rather than once per BSSID
+    const bool FIRST_THIS_SCAN = !entry->seenThisScan;
+    entry->seenThisScan = true;
+    entry->missedScans = 0;
+    if (FIRST_THIS_SCAN || rssi > entry->strongestThisScan) {
+        entry->strongestThisScan = rssi;
+        entry->network.rssi = (entry->rssiBeforeScan + entry->strongestThisScan) / 2;
+    }
+
+    const bool ENCRYPTION_CHANGED = entry->network.encryptionType != encryption_type;
+    entry->network.encryptionType = encryption_type;
+    if (ENCRYPTION_CHANGED || abs(entry->network.rssi - entry->reportedRssi) >= RSSI_CHANGE_THRESHOLD) {
+        entry->reportedRssi = entry->network.rssi;
+        diffs.push_back({WiFiScanChange::CHANGED, entry->network});
+    }
+}
+
+void WiFiScanTable::end_scan(bool complete, std::vector<WiFiScanDiff>& diffs) {
+    if (!complete) {
+        return;
+    }
+
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (it->seenThisScan || ++it->missedScans < MAX_MISSED_SCANS) {
+            ++it;
+            continue;
+        }
+        diffs.push_back({WiFiScanChange::REMOVED, it->network});
+        it = _entries.erase(it);
+    }
+}
+
+std::vector<WiFiNetworkInfo> WiFiScanTable::snapshot() const {
+    std::vector<WiFiNetworkInfo> networks;
+    networks.reserve(_entries.size());
+    for (const Entry& entry : _entries) {
+        networks.push_back(entry.network);
+    }
+    std::sort(networks.begin(), networks.end(), [](const WiFiNetworkInfo& a, const WiFiNetworkInfo& b) { return a.rssi > b.rssi; });
+    return networks;
+}
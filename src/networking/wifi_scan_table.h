@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+#include "utils/structs.h"
+
+enum class WiFiScanChange : uint8_t { ADDED, CHANGED, REMOVED };
+
+struct WiFiScanDiff {
+    WiFiScanChange change;
+    WiFiNetworkInfo network;
+};
+
+// Nearby networks accumulated over successive scans, one entry per SSID (the strongest BSSID wins).
+// RSSI is smoothed across scans, networks missing from MAX_MISSED_SCANS complete scans in a row are aged out,
+// and every mutation that the setup UI needs to hear about is reported as a WiFiScanDiff - so repeated scans
+// only re-send what actually changed.
+class WiFiScanTable {
+  public:
+    void begin_scan();
+
+    // Folds one scan result into the table, appending an ADDED/CHANGED diff if the UI's copy is now out of date
+    void observe(const String& ssid, int32_t rssi, uint8_t encryption_type, std::vector<WiFiScanDiff>& diffs);
+
+    // complete = every channel was scanned. Only complete scans count towards aging out (appending REMOVED diffs)
+    void end_scan(bool complete, std::vector<WiFiScanDiff>& diffs);
+
+    void clear() {
+        _entries.clear();
+    }
+    bool empty() const {
+        return _entries.empty();
+    }
+    size_t size() const {
+        return _entries.size();
+    }
+
+    // Current table sorted by signal strength (strongest first)
+    std::vector<WiFiNetworkInfo> snapshot() const;
+
+  private:
+    struct Entry {
+        WiFiNetworkInfo network; // rssi holds the smoothed value
+        int32_t rssiBeforeScan;
+        int32_t strongestThisScan;
+        int32_t reportedRssi; // What the UI was last told
+        bool seenThisScan;
+        uint8_t missedScans;
+    };
+
+    Entry* find(const String& ssid);
+
+    static constexpr int32_t RSSI_CHANGE_THRESHOLD = 6; // dB of smoothed movement before a CHANGED diff is worth sending
+    static constexpr uint8_t MAX_MISSED_SCANS = 2;
+
+    std::vector<Entry> _entries;
+};
@@ -31,14 +31,17 @@ void BatteryMonitor::update_battery_state() {
         return;
     }
 
-    // Read battery parameters from BQ27441
-    _batteryState.realStateOfCharge = lipo.soc();
-    _batteryState.voltage = lipo.voltage();
-    _batteryState.current = lipo.current(AVG);
-    _batteryState.power = lipo.power();
-    _batteryState.remainingCapacity = lipo.capacity(REMAIN);
-    _batteryState.fullCapacity = lipo.capacity(FULL);
-    _batteryState.health = lipo.soh();
+    // Read battery parameters from BQ27441. Once a second is plenty, so it waits behind the IMU
+    {
+        I2cBusLease lease(_busDevice, I2cPriority::BACKGROUND);
+        _batteryState.realStateOfCharge = lipo.soc();
+        _batteryState.voltage = lipo.voltage();
+        _batteryState.current = lipo.current(AVG);
+        _batteryState.power = lipo.power();
+        _batteryState.remainingCapacity = lipo.capacity(REMAIN);
+        _batteryState.fullCapacity = lipo.capacity(FULL);
+        _batteryState.health = lipo.soh();
+    }
     // Prevent sub-0 values.
     _batteryState.displayedStateOfCharge = max(0.0f, (_batteryState.realStateOfCharge) * (SLOPE_TERM) + Y_INTERCEPT_TERM);
 
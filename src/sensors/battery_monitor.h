@@ -7,6 +7,7 @@
 #include "networking/serial_manager.h"
 #include "networking/serial_queue_manager.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/singleton.h"
 #include "utils/structs.h"
 
@@ -44,6 +45,7 @@ class BatteryMonitor : public Singleton<BatteryMonitor> {
     static constexpr uint32_t CRITICAL_BATTERY_THRESHOLD = 5;  // %
 
     BatteryState _batteryState;
+    I2cDevice _busDevice{I2cBusId::BUS_2, BQ72441_I2C_ADDRESS, "Battery"};
     uint32_t _lastInitAttempt = 0;
     static constexpr uint32_t INIT_RETRY_INTERVAL_MS = 10000;  // Retry init every 10 seconds
     static constexpr uint32_t BATTERY_LOG_INTERVAL_MS = 10000; // Log every 10 seconds
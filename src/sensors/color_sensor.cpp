@@ -1,5 +1,11 @@
 #include "color_sensor.h"
 
+#include <algorithm>
+
+namespace {
+constexpr uint8_t CHANNEL_REGISTERS[] = {0x05, 0x06, 0x07}; // VEML3328 R, G, B data registers
+}
+
 bool ColorSensor::initialize() {
     pinMode(COLOR_SENSOR_LED_PIN, OUTPUT);
 
@@ -11,13 +17,14 @@ bool ColorSensor::initialize() {
     // Try a few times with short delays in between
     for (int attempt = 0; attempt < 3; attempt++) {
         // Try to initialize the sensor with explicit I2C address and wire instance
-        // Use 0x10 address explicitly and pass the already initialized Wire object
-        if (Veml3328.begin(0x10, &Wire) == 0) {
+        // Pass the address explicitly and the already initialized Wire object
+        if (Veml3328.begin(COLOR_SENSOR_ADDRESS, &Wire) == 0) {
             // Configure sensor
             Veml3328.setIntTime(time_50);
             Veml3328.setGain(gain_x1);
             Veml3328.setSensitivity(false);
 
+            build_normalization();
             _sensor_connected = true;
             _is_initialized = true;
             SerialQueueManager::get_instance().queue_message("Color sensor initialized successfully");
@@ -76,7 +83,9 @@ void ColorSensor::update_sensor_data() {
     color_data.green_value = _color_sensor_data.greenValue;
     color_data.blue_value = _color_sensor_data.blueValue;
     color_data.is_valid = _sensor_connected;
-    color_data.timestamp = CURRENT_TIME;
+    color_data.color_class = _colorClass;
+    color_data.class_confidence = _classConfidence;
+    color_data.timestampUs = _readingTimeUs;
 
     // Write to buffer
     SensorDataBuffer::get_instance().update_color_data(color_data);
@@ -89,6 +98,7 @@ void ColorSensor::enable_color_sensor() {
 
     // Turn on LED for color sensor readings
     analogWrite(COLOR_SENSOR_LED_PIN, COLOR_SENSOR_LED_BRIGHTNESS);
+    clear_color_class(); // Nothing from before the sensor went idle counts towards the debounce
 
     _sensor_enabled = true;
     SerialQueueManager::get_instance().queue_message("Color sensor enabled");
@@ -145,6 +155,7 @@ void ColorSensor::calibrate_black_point() {
     _calibration.blackRed = sum_red / NUM_READINGS;
     _calibration.blackGreen = sum_green / NUM_READINGS;
     _calibration.blackBlue = sum_blue / NUM_READINGS;
+    build_normalization();
 
     SerialQueueManager::get_instance().queue_message("Black point calibrated!");
     print_calibration_values();
@@ -181,38 +192,130 @@ void ColorSensor::calibrate_white_point() {
     SerialQueueManager::get_instance().queue_message("White point calibrated!");
     print_calibration_values();
     _is_calibrated = true;
+    build_normalization();
     analogWrite(COLOR_SENSOR_LED_PIN, 0);
 }
 
 void ColorSensor::read_color_sensor() {
-    // Use non-blocking state machine for maximum speed
-    const color_read_state_t STATE = Veml3328.readColorNonBlocking();
+    // Never wait on the bus: take last cycle's reads once they're all in, then queue the next set
+    bool have_reading = true;
+    for (const I2cTransfer& read : _channelReads) {
+        if (!read.is_done()) {
+            return;
+        }
+        have_reading = have_reading && read.status.load() == I2cStatus::OK;
+    }
+    const uint16_t RED = _channelReads[0].word();
+    const uint16_t GREEN = _channelReads[1].word();
+    const uint16_t BLUE = _channelReads[2].word();
+    const uint64_t READ_TIME_US = _channelReads[CHANNEL_COUNT - 1].completedUs;
 
-    // Only process when we have complete reading
-    if (STATE != COLOR_STATE_COMPLETE) {
+    for (uint8_t i = 0; i < CHANNEL_COUNT; i++) {
+        _busDevice.read_async(_channelReads[i], CHANNEL_REGISTERS[i], 2, I2cPriority::NORMAL, CHANNEL_READ_DEADLINE_MS);
+    }
+
+    if (!have_reading) {
         return;
     }
-    const uint16_t RED = Veml3328.getLastRed();
-    const uint16_t GREEN = Veml3328.getLastGreen();
-    const uint16_t BLUE = Veml3328.getLastBlue();
-
-    if (_is_calibrated) {
-        // Use calibrated normalization
-        auto safe_normalize = [](uint16_t value, uint16_t black, uint16_t white) -> uint8_t {
-            if (white <= black) {
-                return 0; // Invalid calibration
-            }
-            const int32_t NORMALIZED = (static_cast<int32_t>(value - black) * 255L) / (white - black);
-            return static_cast<uint8_t> constrain(NORMALIZED, 0, 255);
-        };
-
-        _color_sensor_data.redValue = safe_normalize(RED, _calibration.blackRed, _calibration.whiteRed);
-        _color_sensor_data.greenValue = safe_normalize(GREEN, _calibration.blackGreen, _calibration.whiteGreen);
-        _color_sensor_data.blueValue = safe_normalize(BLUE, _calibration.blackBlue, _calibration.whiteBlue);
-    } else {
-        // Fallback to simple 8-bit conversion if not calibrated
-        _color_sensor_data.redValue = static_cast<uint8_t>(RED >> 8);
-        _color_sensor_data.greenValue = static_cast<uint8_t>(GREEN >> 8);
-        _color_sensor_data.blueValue = static_cast<uint8_t>(BLUE >> 8);
+    _readingTimeUs = READ_TIME_US;
+
+    _color_sensor_data.redValue = normalize(0, RED);
+    _color_sensor_data.greenValue = normalize(1, GREEN);
+    _color_sensor_data.blueValue = normalize(2, BLUE);
+    update_color_class(classify(_color_sensor_data));
+}
+
+void ColorSensor::build_normalization() {
+    const uint16_t BLACK[CHANNEL_COUNT] = {_calibration.blackRed, _calibration.blackGreen, _calibration.blackBlue};
+    const uint16_t WHITE[CHANNEL_COUNT] = {_calibration.whiteRed, _calibration.whiteGreen, _calibration.whiteBlue};
+
+    for (uint8_t channel = 0; channel < CHANNEL_COUNT; channel++) {
+        _channelBlack[channel] = BLACK[channel];
+        _channelScale[channel] = 0;
+        if (WHITE[channel] > BLACK[channel]) {
+            const uint64_t SPAN = WHITE[channel] - BLACK[channel];
+            _channelScale[channel] = ((255ULL << RECIPROCAL_SHIFT) + SPAN - 1) / SPAN;
+        }
+    }
+}
+
+uint8_t ColorSensor::normalize(uint8_t channel, uint16_t raw) const {
+    if (!_is_calibrated) {
+        return static_cast<uint8_t>(raw >> 8); // Fallback to simple 8-bit conversion
+    }
+    if (raw <= _channelBlack[channel]) {
+        return 0;
+    }
+    const uint64_t NORMALIZED = (static_cast<uint64_t>(raw - _channelBlack[channel]) * _channelScale[channel]) >> RECIPROCAL_SHIFT;
+    return static_cast<uint8_t>(std::min<uint64_t>(NORMALIZED, 255));
+}
+
+ColorType ColorSensor::classify(const ColorSensorData& color) {
+    const uint8_t R = color.redValue;
+    const uint8_t G = color.greenValue;
+    const uint8_t B = color.blueValue;
+
+    // White: All components bright
+    if (R > 130 && G > 130 && B > 130) {
+        return ColorType::COLOR_WHITE;
+    }
+
+    // Yellow: Red and Green strong, Blue weak
+    if (R > 120 && G > 120 && B < 100) {
+        return ColorType::COLOR_YELLOW;
+    }
+
+    // Red: R dominant and bright enough
+    if (R > 80 && R > (G + 30) && R > (B + 30)) {
+        return ColorType::COLOR_RED;
+    }
+
+    // Green: G dominant and bright enough
+    if (G > 65 && G > (R + 20) && G > (B + 20)) {
+        return ColorType::COLOR_GREEN;
+    }
+
+    // Blue: B dominant and bright enough
+    if (B > 65 && B > (R + 20) && B > (G + 20)) {
+        return ColorType::COLOR_BLUE;
+    }
+
+    // Black: All components dark
+    if (R < 60 && G < 60 && B < 60) {
+        return ColorType::COLOR_BLACK;
+    }
+
+    return ColorType::COLOR_NONE;
+}
+
+void ColorSensor::update_color_class(ColorType sample_class) {
+    _classHistory[_classHistoryIndex] = sample_class;
+    _classHistoryIndex = (_classHistoryIndex + 1) % CLASS_HISTORY_LENGTH;
+
+    // Most common class in the history
+    uint8_t counts[ColorType::COLOR_NONE + 1] = {};
+    ColorType most_common = ColorType::COLOR_NONE;
+    uint8_t most_common_count = 0;
+    for (ColorType color : _classHistory) {
+        counts[color]++;
+        if (counts[color] > most_common_count) {
+            most_common = color;
+            most_common_count = counts[color];
+        }
+    }
+
+    _colorClass = ColorType::COLOR_NONE;
+    if (most_common_count >= CLASS_CONFIRM_COUNT) {
+        _colorClass = most_common;
+    }
+    _classConfidence = static_cast<uint8_t>((most_common_count * 100) / CLASS_HISTORY_LENGTH);
+}
+
+void ColorSensor::clear_color_class() {
+    for (ColorType& color : _classHistory) {
+        color = ColorType::COLOR_NONE;
     }
+    _classHistoryIndex = 0;
+    _colorClass = ColorType::COLOR_NONE;
+    _classConfidence = 0;
 }
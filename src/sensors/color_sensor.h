@@ -3,6 +3,7 @@
 #include "networking/serial_queue_manager.h"
 #include "sensor_data_buffer.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/singleton.h"
 #include "utils/structs.h"
 
@@ -12,7 +13,9 @@ class ColorSensor : public Singleton<ColorSensor> {
     friend class SensorInitializer;
 
   private:
-    ColorSensor() : _color_sensor_data{0, 0, 0} {}
+    ColorSensor() : _color_sensor_data{0, 0, 0} {
+        clear_color_class();
+    }
     bool initialize();
     void read_color_sensor();
     void calibrate_black_point();
@@ -36,6 +39,35 @@ class ColorSensor : public Singleton<ColorSensor> {
 
     bool _is_calibrated = true;
     ColorSensorData _color_sensor_data;
+
+    // Red, green and blue are read as three async register reads per cycle; the task collects them on its next pass
+    static constexpr uint8_t COLOR_SENSOR_ADDRESS = 0x10;
+    static constexpr uint8_t CHANNEL_COUNT = 3;
+    static constexpr uint32_t CHANNEL_READ_DEADLINE_MS = 50; // One task period
+    I2cDevice _busDevice{I2cBusId::BUS_1, COLOR_SENSOR_ADDRESS, "Color"};
+    I2cTransfer _channelReads[CHANNEL_COUNT];
+    uint64_t _readingTimeUs = 0; // When the reads behind _color_sensor_data came off the bus
+
+    // The black/white calibration folded into a reciprocal per channel (255 / (white - black), 32 fractional bits,
+    // rounded up), rebuilt when the calibration changes. For 16-bit readings and spans the multiply-and-shift gives
+    // exactly the quotient the division would
+    static constexpr uint8_t RECIPROCAL_SHIFT = 32;
+    uint16_t _channelBlack[CHANNEL_COUNT] = {};
+    uint64_t _channelScale[CHANNEL_COUNT] = {}; // 0 when white <= black (invalid calibration)
+    void build_normalization();
+    uint8_t normalize(uint8_t channel, uint16_t raw) const;
+
+    // Each new sample is classified once here, then debounced over the last few samples
+    static constexpr uint8_t CLASS_HISTORY_LENGTH = 5;
+    static constexpr uint8_t CLASS_CONFIRM_COUNT = 4;
+    ColorType _classHistory[CLASS_HISTORY_LENGTH];
+    uint8_t _classHistoryIndex = 0;
+    ColorType _colorClass = ColorType::COLOR_NONE;
+    uint8_t _classConfidence = 0;
+    static ColorType classify(const ColorSensorData& color);
+    void update_color_class(ColorType sample_class);
+    void clear_color_class();
+
     uint32_t _last_update_time = 0;
     static constexpr uint32_t DELAY_BETWEEN_READINGS = 20; // ms - minimal delay like performance test
 
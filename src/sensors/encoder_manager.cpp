@@ -1,8 +1,13 @@
 #include "encoder_manager.h"
 
+#include "pose_estimator.h"
 #include "utils/config.h"
 
-EncoderManager::EncoderManager() : _leftWheelRPM(0), _rightWheelRPM(0), _lastUpdateTime(0), _isInitialized(false) {
+portMUX_TYPE EncoderManager::_edgeLock = portMUX_INITIALIZER_UNLOCKED;
+
+EncoderManager::EncoderManager()
+    : _leftEncoder(true, on_encoder_edge, &_leftVelocity), _rightEncoder(true, on_encoder_edge, &_rightVelocity), _leftWheelRPM(0),
+      _rightWheelRPM(0), _isInitialized(false) {
     // Will be set to true in initialize()
     SerialQueueManager::get_instance().queue_message("Creating encoder manager");
 }
@@ -17,6 +22,9 @@ bool EncoderManager::initialize() {
     // Initialize ESP32Encoder library
     ESP32Encoder::useInternalWeakPullResistors = puType::up;
 
+    _leftVelocity.encoder = &_leftEncoder;
+    _rightVelocity.encoder = &_rightEncoder;
+
     // Setup left encoder
     _leftEncoder.attachFullQuad(LEFT_MOTOR_ENCODER_A, LEFT_MOTOR_ENCODER_B);
     _leftEncoder.clearCount();
@@ -25,46 +33,81 @@ bool EncoderManager::initialize() {
     _rightEncoder.attachFullQuad(RIGHT_MOTOR_ENCODER_A, RIGHT_MOTOR_ENCODER_B);
     _rightEncoder.clearCount();
 
-    _lastUpdateTime = millis();
+    _lastUpdateUs = micros64();
+    _leftVelocity.lastEdgeUs = _lastUpdateUs;
+    _rightVelocity.lastEdgeUs = _lastUpdateUs;
     _leftEncoderStartCount = 0;
     _rightEncoderStartCount = 0;
-    _leftLastCount = 0;
-    _rightLastCount = 0;
 
     _isInitialized = true;
     SerialQueueManager::get_instance().queue_message("Encoder Manager initialized successfully");
     return true;
 }
 
-void EncoderManager::update() {
-    const uint32_t CURRENT_TIME = millis();
-    uint32_t elapsed_time = CURRENT_TIME - _lastUpdateTime;
-
-    // Only update if enough time has passed
-    if (elapsed_time < RPM_CALC_INTERVAL) {
-        return;
-    }
+void EncoderManager::update(uint64_t now_us) {
+    update_wheel_velocity(_leftVelocity, now_us);
+    update_wheel_velocity(_rightVelocity, now_us);
 
-    int64_t left_current_count = _leftEncoder.getCount();
-    int64_t right_current_count = _rightEncoder.getCount();
+    _leftWheelRPM = to_wheel_rpm(_leftVelocity.rate);
+    _rightWheelRPM = to_wheel_rpm(_rightVelocity.rate);
+    _lastUpdateUs = now_us;
+}
 
-    // Calculate delta pulses since last update
-    int64_t left_pulses = left_current_count - _leftLastCount;
-    int64_t right_pulses = right_current_count - _rightLastCount;
+void EncoderManager::update_wheel_velocity(WheelVelocity& wheel, uint64_t now_us) {
+    portENTER_CRITICAL(&_edgeLock);
+    const int64_t EDGE_COUNT = wheel.edgeCount;
+    const uint64_t EDGE_US = wheel.edgeUs;
+    portEXIT_CRITICAL(&_edgeLock);
+
+    if (EDGE_COUNT != wheel.lastCount && EDGE_US > wheel.lastEdgeUs) {
+        // Every count since the last update, over exactly the time their edges spanned
+        wheel.measuredRate = static_cast<float>(EDGE_COUNT - wheel.lastCount) * 1000000.0f / static_cast<float>(EDGE_US - wheel.lastEdgeUs);
+        wheel.lastCount = EDGE_COUNT;
+        wheel.lastEdgeUs = EDGE_US;
+    } else {
+        // No new edge: the wheel can't be turning faster than one count over the time since the last one
+        const uint64_t SINCE_EDGE_US = now_us - wheel.lastEdgeUs;
+        if (SINCE_EDGE_US >= STOPPED_TIMEOUT_US) {
+            wheel.measuredRate = 0.0f;
+        } else {
+            const float BOUND = 1000000.0f / static_cast<float>(SINCE_EDGE_US);
+            if (fabsf(wheel.measuredRate) > BOUND) {
+                wheel.measuredRate = copysignf(BOUND, wheel.measuredRate);
+            }
+        }
+    }
 
-    // Calculate motor shaft RPM - NOTE: Using elapsedTime in seconds
-    float left_motor_shaft_rpm = static_cast<float>(left_pulses * 60) / (PULSES_PER_REVOLUTION * (elapsed_time / 1000.0));
-    float right_motor_shaft_rpm = static_cast<float>(right_pulses * 60) / (PULSES_PER_REVOLUTION * (elapsed_time / 1000.0));
+    if (!USE_ALPHA_BETA_FILTER || wheel.measuredRate == 0.0f) {
+        // Stopped is exact - don't let the filter coast past zero
+        wheel.rate = wheel.measuredRate;
+        wheel.rateChange = 0.0f;
+        return;
+    }
 
-    // Calculate wheel RPM
-    _leftWheelRPM = left_motor_shaft_rpm / GEAR_RATIO;
-    _rightWheelRPM = right_motor_shaft_rpm / GEAR_RATIO;
+    const float DELTA_TIME = static_cast<float>(now_us - _lastUpdateUs) / 1000000.0f;
+    const float PREDICTED = wheel.rate + wheel.rateChange * DELTA_TIME;
+    const float RESIDUAL = wheel.measuredRate - PREDICTED;
+    wheel.rate = PREDICTED + FILTER_ALPHA * RESIDUAL;
+    if (DELTA_TIME > 0.0f) {
+        wheel.rateChange += FILTER_BETA * RESIDUAL / DELTA_TIME;
+    }
+}
 
-    // Store current counts for next delta calculation
-    _leftLastCount = left_current_count;
-    _rightLastCount = right_current_count;
+float EncoderManager::to_wheel_rpm(float counts_per_second) const {
+    // Motor shaft RPM, then through the gearbox
+    return counts_per_second * 60.0f / static_cast<float>(PULSES_PER_REVOLUTION) / GEAR_RATIO;
+}
 
-    _lastUpdateTime = CURRENT_TIME;
+void IRAM_ATTR EncoderManager::on_encoder_edge(void* arg) {
+    // Runs inside the PCNT interrupt right after it folded the edge into the encoder's count
+    auto* wheel = static_cast<WheelVelocity*>(arg);
+    if (wheel->encoder == nullptr) {
+        return;
+    }
+    portENTER_CRITICAL_ISR(&_edgeLock);
+    wheel->edgeCount = wheel->encoder->count;
+    wheel->edgeUs = micros64();
+    portEXIT_CRITICAL_ISR(&_edgeLock);
 }
 
 // Standard sensor interface methods
@@ -77,8 +120,10 @@ void EncoderManager::update_sensor_data() {
         return;
     }
 
+    const uint64_t CAPTURE_TIME_US = micros64();
+
     // Call internal update method to calculate RPMs
-    update();
+    update(CAPTURE_TIME_US);
 
     // Calculate distance traveled inline and capture raw counts
     float distance_traveled = 0.0f;
@@ -117,8 +162,10 @@ void EncoderManager::update_sensor_data() {
     encoder_data.left_encoder_count = left_count;   // Raw counts for motor driver
     encoder_data.right_encoder_count = right_count; // Raw counts for motor driver
     encoder_data.is_valid = true;
-    encoder_data.timestamp = millis();
+    encoder_data.timestampUs = CAPTURE_TIME_US;
 
     // Write to sensor data buffer
     SensorDataBuffer::get_instance().update_encoder_data(encoder_data);
+
+    PoseEstimator::get_instance().update(encoder_data);
 }
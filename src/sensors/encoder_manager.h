@@ -18,6 +18,7 @@ class EncoderManager : public Singleton<EncoderManager> {
     friend class MotorDriver;       // Allows MotorDriver to access private members
     friend class TaskManager;       // Allows TaskManager to access private methods
     friend class SensorInitializer; // Allows TaskManager to access private methods
+    friend class PoseEstimator;     // Wheel geometry
 
   private:
     // Constructor
@@ -33,8 +34,33 @@ class EncoderManager : public Singleton<EncoderManager> {
     float _rightWheelRPM;
     bool _isInitialized = false;
 
-    // Timing
-    uint32_t _lastUpdateTime;
+    // Wheel speed from edge timing: the PCNT interrupt fires on every count and stamps it, and each update divides the
+    // counts since the previous update by the exact time between their edges. That keeps full resolution at low speed
+    // (where a fixed window sees 0 or 1 counts) and at high speed (where it's a plain frequency count), then a small
+    // alpha-beta filter smooths what's left of the edge jitter
+    struct WheelVelocity {
+        ESP32Encoder* encoder = nullptr;
+
+        // Written by the PCNT interrupt, read under _edgeLock
+        int64_t edgeCount = 0; // Count right after the latest edge
+        uint64_t edgeUs = 0;   // micros64() of that edge
+
+        // Encoder task only
+        int64_t lastCount = 0;
+        uint64_t lastEdgeUs = 0;
+        float measuredRate = 0.0f; // counts/s
+        float rate = 0.0f;         // Filtered counts/s
+        float rateChange = 0.0f;   // Filtered counts/s^2
+    };
+
+    static void on_encoder_edge(void* arg);
+    void update_wheel_velocity(WheelVelocity& wheel, uint64_t now_us);
+    float to_wheel_rpm(float counts_per_second) const;
+
+    WheelVelocity _leftVelocity;
+    WheelVelocity _rightVelocity;
+    uint64_t _lastUpdateUs = 0;
+    static portMUX_TYPE _edgeLock;
 
     // Standard sensor interface methods (for TaskManager)
     void update_sensor_data(); // Single read, write to buffer
@@ -45,22 +71,23 @@ class EncoderManager : public Singleton<EncoderManager> {
     static constexpr uint8_t MOTOR_ENCODER_CPR = 12; // cycles per revolution on motor shaft
     // attachFullQuad counts all 4 edges (4x resolution)
     static constexpr uint8_t PULSES_PER_REVOLUTION = MOTOR_ENCODER_CPR;
-    static constexpr uint32_t RPM_CALC_INTERVAL = 20; // ms
+
+    // Velocity estimator
+    static constexpr uint32_t STOPPED_TIMEOUT_US = 150000; // No edge for this long: the wheel is stopped
+    static constexpr bool USE_ALPHA_BETA_FILTER = true;    // false: publish the raw edge-timed rate
+    static constexpr float FILTER_ALPHA = 0.5f;            // Rate correction gain
+    static constexpr float FILTER_BETA = 0.1f;             // Rate-of-change correction gain
 
     // Wheel physical properties
     static constexpr float WHEEL_DIAMETER_IN = 1.535; // 39mm converted to inches
     static constexpr float WHEEL_CIRCUMFERENCE_IN = WHEEL_DIAMETER_IN * PI;
 
     // Internal update method (now private - called by updateSensorData)
-    void update();
+    void update(uint64_t now_us);
 
     int64_t _leftEncoderStartCount{};
     int64_t _rightEncoderStartCount{};
 
-    // For RPM calculation without clearing encoder counts
-    int64_t _leftLastCount{};
-    int64_t _rightLastCount{};
-
     // Wheel physical properties
     static constexpr float WHEEL_DIAMETER_CM = 3.9; // Replace with actual wheel diameter
     static constexpr float WHEEL_CIRCUMFERENCE_CM = WHEEL_DIAMETER_CM * PI;
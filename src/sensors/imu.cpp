@@ -8,6 +8,9 @@ bool ImuSensor::initialize() {
     for (int attempt = 0; attempt < 3; attempt++) {
         if (_imu.begin_I2C(IMU_DEFAULT_ADDRESS, &Wire1)) {
             SerialQueueManager::get_instance().queue_message("BNO08x Found!");
+            // Take over report decoding from the library so no report in a multi-report transfer is lost
+            sh2_setSensorCallback(on_sensor_event, this);
+            attach_data_ready_interrupt();
             _isInitialized = true;
             return true;
         }
@@ -140,67 +143,128 @@ bool ImuSensor::should_be_polling() const {
            timeouts.should_enable_gyroscope() || timeouts.should_enable_magnetometer();
 }
 
-// New simplified update method - replaces old updateAllSensorData
 void ImuSensor::update_sensor_data() {
     if (!_isInitialized) {
         return;
     }
 
-    // Update enabled reports based on timeouts
-    update_enabled_reports();
+    {
+        // Motion control depends on these, so the IMU outranks everything else on Wire1
+        I2cBusLease lease(_busDevice, I2cPriority::CRITICAL);
 
-    // Single read attempt - no more 8X loop!
-    if (!_imu.getSensorEvent(&_sensorValue)) {
-        return;
+        // Update enabled reports based on timeouts
+        update_enabled_reports();
+
+        drain_events();
     }
-    SensorDataBuffer& buffer = SensorDataBuffer::get_instance();
 
-    switch (_sensorValue.sensorId) {
-        case SH2_GAME_ROTATION_VECTOR: {
-            QuaternionData quaternion;
-            quaternion.qX = _sensorValue.un.gameRotationVector.i;
-            quaternion.qY = _sensorValue.un.gameRotationVector.j;
-            quaternion.qZ = _sensorValue.un.gameRotationVector.k;
-            quaternion.qW = _sensorValue.un.gameRotationVector.real;
-            quaternion.isValid = true;
+    publish_batch();
+}
 
-            buffer.update_quaternion(quaternion);
+void ImuSensor::drain_events() {
+    // Each sh2_service() reads at most one SHTP transfer, so keep going until the FIFO is empty rather than leaving
+    // reports to age in it until the next tick
+    for (uint8_t i = 0; i < MAX_SERVICE_CALLS; i++) {
+        const uint32_t EVENTS_BEFORE = _batchEvents;
+        sh2_service();
+
+        if (_interruptAttached) {
+            if (digitalRead(IMU_INT_PIN) == HIGH) {
+                break; // INT released - nothing left to read
+            }
+        } else if (_batchEvents == EVENTS_BEFORE) {
             break;
         }
+    }
+}
 
-        case SH2_ACCELEROMETER: {
-            AccelerometerData accel;
-            accel.aX = _sensorValue.un.accelerometer.x;
-            accel.aY = _sensorValue.un.accelerometer.y;
-            accel.aZ = _sensorValue.un.accelerometer.z;
-            accel.isValid = true;
+void ImuSensor::on_sensor_event(void* cookie, sh2_SensorEvent_t* event) {
+    auto* instance = static_cast<ImuSensor*>(cookie);
+    sh2_SensorValue_t value;
+    if (sh2_decodeSensor(event, &value) != SH2_OK) {
+        return;
+    }
 
-            buffer.update_accelerometer(accel);
+    // SH-2 timestamps come from the sensor's own sample time (report delay included), not from when we read it
+    ImuSample& batch = instance->_batch;
+    switch (value.sensorId) {
+        case SH2_GAME_ROTATION_VECTOR:
+            batch.quaternion.qX = value.un.gameRotationVector.i;
+            batch.quaternion.qY = value.un.gameRotationVector.j;
+            batch.quaternion.qZ = value.un.gameRotationVector.k;
+            batch.quaternion.qW = value.un.gameRotationVector.real;
+            batch.quaternion.isValid = true;
+            batch.quaternion.timestampUs = value.timestamp;
             break;
-        }
 
-        case SH2_GYROSCOPE_CALIBRATED: {
-            GyroscopeData gyro;
-            gyro.gX = _sensorValue.un.gyroscope.x;
-            gyro.gY = _sensorValue.un.gyroscope.y;
-            gyro.gZ = _sensorValue.un.gyroscope.z;
-            gyro.isValid = true;
-
-            buffer.update_gyroscope(gyro);
+        case SH2_ACCELEROMETER:
+            batch.accelerometer.aX = value.un.accelerometer.x;
+            batch.accelerometer.aY = value.un.accelerometer.y;
+            batch.accelerometer.aZ = value.un.accelerometer.z;
+            batch.accelerometer.isValid = true;
+            batch.accelerometer.timestampUs = value.timestamp;
             break;
-        }
 
-        case SH2_MAGNETIC_FIELD_CALIBRATED: {
-            MagnetometerData mag;
-            mag.mX = _sensorValue.un.magneticField.x;
-            mag.mY = _sensorValue.un.magneticField.y;
-            mag.mZ = _sensorValue.un.magneticField.z;
-            mag.isValid = true;
+        case SH2_GYROSCOPE_CALIBRATED:
+            batch.gyroscope.gX = value.un.gyroscope.x;
+            batch.gyroscope.gY = value.un.gyroscope.y;
+            batch.gyroscope.gZ = value.un.gyroscope.z;
+            batch.gyroscope.isValid = true;
+            batch.gyroscope.timestampUs = value.timestamp;
+            break;
 
-            buffer.update_magnetometer(mag);
+        case SH2_MAGNETIC_FIELD_CALIBRATED:
+            batch.magnetometer.mX = value.un.magneticField.x;
+            batch.magnetometer.mY = value.un.magneticField.y;
+            batch.magnetometer.mZ = value.un.magneticField.z;
+            batch.magnetometer.isValid = true;
+            batch.magnetometer.timestampUs = value.timestamp;
             break;
-        }
+
+        default:
+            return;
+    }
+    instance->_batchEvents++;
+}
+
+void ImuSensor::publish_batch() {
+    if (_batchEvents == 0) {
+        return;
+    }
+    SensorDataBuffer::get_instance().update_imu_batch(_batch, _batchEvents);
+    _batch = ImuSample();
+    _batchEvents = 0;
+}
+
+void ImuSensor::attach_data_ready_interrupt() {
+    if (IMU_INT_PIN < 0 || _interruptAttached) {
+        return; // Not wired - stay in polling mode
+    }
+    pinMode(IMU_INT_PIN, INPUT_PULLUP);
+    attachInterruptArg(digitalPinToInterrupt(IMU_INT_PIN), on_data_ready, this, FALLING);
+    _interruptAttached = true;
+    SerialQueueManager::get_instance().queue_message("IMU using data-ready interrupt");
+}
+
+void IRAM_ATTR ImuSensor::on_data_ready(void* arg) {
+    auto* instance = static_cast<ImuSensor*>(arg);
+    if (instance->_taskHandle == nullptr) {
+        return;
+    }
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(instance->_taskHandle, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+void ImuSensor::register_task(TaskHandle_t task_handle) {
+    _taskHandle = task_handle;
+}
+
+uint32_t ImuSensor::get_wait_ms() const {
+    if (_interruptAttached) {
+        return INTERRUPT_IDLE_WAIT_MS;
     }
+    return POLL_WAIT_MS;
 }
 
 void ImuSensor::turn_off() {
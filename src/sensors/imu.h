@@ -1,8 +1,11 @@
 #pragma once
 #include <Adafruit_BNO08x.h>
+#include <sh2.h>
+#include <sh2_SensorValue.h>
 
 #include "sensor_data_buffer.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/singleton.h"
 #include "utils/structs.h"
 #include "utils/utils.h"
@@ -17,9 +20,29 @@ class ImuSensor : public Singleton<ImuSensor> {
     bool initialize();
     void turn_off();
     Adafruit_BNO08x _imu;
-    sh2_SensorValue_t _sensorValue{};
     bool _isInitialized = false;
 
+    // Drain-all batching: one wake-up reads every pending SHTP transfer, and each SH-2 report in them is folded into
+    // _batch (newest of each type wins) by our own sensor callback - the library's getSensorEvent() keeps only the last
+    // report of a transfer. The batch is then published to SensorDataBuffer in one update
+    static void on_sensor_event(void* cookie, sh2_SensorEvent_t* event);
+    void drain_events();
+    void publish_batch();
+    ImuSample _batch;
+    uint32_t _batchEvents = 0;
+
+    // Data-ready interrupt: the ISR only notifies the IMU task, which then drains the FIFO
+    void attach_data_ready_interrupt();
+    static void on_data_ready(void* arg);
+    void register_task(TaskHandle_t task_handle);
+    uint32_t get_wait_ms() const;
+
+    static const uint16_t POLL_WAIT_MS = 5;            // 200Hz - critical for motion control
+    static const uint16_t INTERRUPT_IDLE_WAIT_MS = 20; // Longest sleep with the interrupt, so report enables still run
+    static const uint8_t MAX_SERVICE_CALLS = 16;       // SHTP transfers drained per wake-up, at most
+    TaskHandle_t _taskHandle = nullptr;
+    bool _interruptAttached = false;
+
     // Report management based on timeout system
     EnabledReports _enabledReports;
     void update_enabled_reports(); // Check timeouts and enable/disable reports
@@ -35,6 +58,7 @@ class ImuSensor : public Singleton<ImuSensor> {
 
     const uint16_t IMU_UPDATE_FREQ_MICROSECS = 5000; // 5ms, 200Hz
     const uint8_t IMU_DEFAULT_ADDRESS = 0x4A;        // 5ms, 200Hz
+    I2cDevice _busDevice{I2cBusId::BUS_2, IMU_DEFAULT_ADDRESS, "IMU"};
 
     // Polling control
     void update_sensor_data(); // Single read, write to buffer
@@ -4,6 +4,9 @@ bool MultizoneTofSensor::initialize() {
     // Add a delay before trying to initialize
     vTaskDelay(pdMS_TO_TICKS(50));
 
+    // Firmware and configuration uploads go out in a few large transactions instead of 32-byte Wire writes
+    _sensor.vl53l7cx_set_i2c_port(I2C_1_PORT);
+
     // Try a few times with short delays in between
     for (int attempt = 0; attempt < 3; attempt++) {
         if (_sensor.begin() == 0) {
@@ -13,6 +16,7 @@ bool MultizoneTofSensor::initialize() {
                 if (configure_sensor()) {
                     // Initialize point histories
                     initialize_point_histories();
+                    attach_data_ready_interrupt();
 
                     SerialQueueManager::get_instance().queue_message("MZ TOF sensor initialization complete");
                     _isInitialized = true;
@@ -45,16 +49,17 @@ void MultizoneTofSensor::update_sensor_data() {
         return;
     }
 
-    // Throttle VL53L7CX checks to 50Hz max (every 20ms) to reduce I2C load
+    // Without the interrupt, throttle VL53L7CX checks to 50Hz max (every 20ms) to reduce I2C load
     static uint32_t last_check_time = 0;
     const uint32_t CURRENT_TIME = millis();
 
-    if (CURRENT_TIME - last_check_time < CHECK_SENSOR_TIME) {
-        return;
+    if (!_interruptAttached) {
+        if (CURRENT_TIME - last_check_time < CHECK_SENSOR_TIME) {
+            return;
+        }
+        last_check_time = CURRENT_TIME;
     }
 
-    last_check_time = CURRENT_TIME;
-
     // Check if we should enable/disable the sensor based on timeouts
     ReportTimeouts& timeouts = SensorDataBuffer::get_instance().get_report_timeouts();
     const bool SHOULD_ENABLE = timeouts.should_enable_tof();
@@ -76,35 +81,47 @@ void MultizoneTofSensor::update_sensor_data() {
         return;
     }
 
-    uint8_t is_data_ready = 0;
-
-    // Check if new data is ready
-    if (_sensor.vl53l7cx_check_data_ready(&is_data_ready) != 0 || is_data_ready == 0) {
+    // INT already said a frame is waiting, so skip the data-ready poll
+    if (_interruptAttached && !consume_data_ready()) {
         return;
     }
 
-    // Get the ranging data
-    VL53L7CX_ResultsData raw_data;
-    if (_sensor.vl53l7cx_get_ranging_data(&raw_data) != 0) {
-        return; // Failed to get data
+    TofData tof_data;
+    {
+        // The data-ready poll and the frame read share one lease, ahead of color and display traffic
+        I2cBusLease lease(_busDevice, I2cPriority::URGENT);
+        if (!lease.is_held()) {
+            return;
+        }
+
+        uint8_t is_data_ready = 0;
+
+        // Check if new data is ready
+        if (!_interruptAttached && (_sensor.vl53l7cx_check_data_ready(&is_data_ready) != 0 || is_data_ready == 0)) {
+            return;
+        }
+        // The sensor has no clock of its own to report; the edge (or the poll that found the frame) is the closest
+        tof_data.timestampUs = _interruptAttached ? get_data_ready_us() : micros64();
+
+        // Get the ranging data, straight into the buffer entry
+        if (_sensor.vl53l7cx_get_ranging_frame(&tof_data.frame) != 0) {
+            return; // Failed to get data
+        }
+        tof_data.stream_count = _sensor.get_stream_count();
     }
 
     // Update watchdog timer on successful data reception
     _lastValidDataTime = millis();
 
-    // Process obstacle detection with the raw data
-    const bool OBSTACLE_DETECTED = process_obstacle_detection(raw_data);
+    // Process obstacle detection with the frame
+    const bool OBSTACLE_DETECTED = process_obstacle_detection(tof_data.frame);
 
     // Calculate front distance from ROI zones
-    const float FRONT_DISTANCE = calculate_front_distance(raw_data);
+    const float FRONT_DISTANCE = calculate_front_distance(tof_data.frame);
 
-    // Create TofData structure and write to buffer
-    TofData tof_data;
-    tof_data.raw_data = raw_data;
     tof_data.is_object_detected = OBSTACLE_DETECTED;
     tof_data.front_distance = FRONT_DISTANCE;
     tof_data.is_valid = true;
-    tof_data.timestamp = millis();
 
     // Write to buffer
     SensorDataBuffer::get_instance().update_tof_data(tof_data);
@@ -116,6 +133,7 @@ void MultizoneTofSensor::enable_tof_sensor() {
     }
 
     start_ranging();
+    attach_data_ready_interrupt(); // No-op if still attached; turn_off_sensor() detaches it
     _sensorActive = true;
     _sensorEnabled = true;
     _lastValidDataTime = millis();
@@ -135,7 +153,7 @@ void MultizoneTofSensor::disable_tof_sensor() {
     SerialQueueManager::get_instance().queue_message("MZ TOF sensor disabled due to timeout");
 }
 
-bool MultizoneTofSensor::process_obstacle_detection(const VL53L7CX_ResultsData& raw_data) const {
+bool MultizoneTofSensor::process_obstacle_detection(const VL53L7CX_RangingFrame& frame) const {
     const MultizoneTofSensor& instance = MultizoneTofSensor::get_instance();
     // First update all point histories with current readings
     for (int row_index = 0; row_index < ROI_ROWS; row_index++) {
@@ -148,9 +166,9 @@ bool MultizoneTofSensor::process_obstacle_detection(const VL53L7CX_ResultsData&
             const int INDEX = (ROW * 8) + COL;
 
             // Check if we have valid data for this point
-            if (raw_data.nb_target_detected[INDEX] > 0) {
-                const uint16_t DISTANCE = raw_data.distance_mm[INDEX];
-                const uint8_t STATUS = raw_data.target_status[INDEX];
+            if (frame.nb_target_detected[INDEX] > 0) {
+                const uint16_t DISTANCE = frame.distance_mm[INDEX];
+                const uint8_t STATUS = frame.target_status[INDEX];
 
                 // Apply filtering parameters
                 if (DISTANCE <= instance._MAX_DISTANCE && DISTANCE >= instance._MIN_DISTANCE && STATUS >= instance._SIGNAL_THRESHOLD) {
@@ -239,6 +257,7 @@ bool MultizoneTofSensor::configure_sensor() {
     instance._sensor.vl53l7cx_set_xtalk_margin(instance._X_TALK_MARGIN);
     instance._sensor.vl53l7cx_set_sharpener_percent(instance._SHARPENER_PERCENT);
     instance._sensor.vl53l7cx_set_integration_time_ms(instance._INTEGRATION_TIME_MS);
+    instance._sensor.vl53l7cx_set_output_enables(instance._OUTPUT_ENABLES);
     instance._sensor.vl53l7cx_enable_non_blocking_mode();
 
     return true;
@@ -297,7 +316,75 @@ void MultizoneTofSensor::stop_ranging() {
     _sensor.vl53l7cx_stop_ranging();
 }
 
+void MultizoneTofSensor::attach_data_ready_interrupt() {
+    if (MULTIZONE_TOF_INT_PIN < 0 || _interruptAttached) {
+        return; // Not wired - stay in polling mode
+    }
+    pinMode(MULTIZONE_TOF_INT_PIN, INPUT_PULLUP);
+    _dataReady = false;
+    attachInterruptArg(digitalPinToInterrupt(MULTIZONE_TOF_INT_PIN), on_data_ready, this, FALLING);
+    _interruptAttached = true;
+    SerialQueueManager::get_instance().queue_message("MZ TOF using data-ready interrupt");
+}
+
+void MultizoneTofSensor::detach_data_ready_interrupt() {
+    if (!_interruptAttached) {
+        return;
+    }
+    detachInterrupt(digitalPinToInterrupt(MULTIZONE_TOF_INT_PIN));
+    _interruptAttached = false;
+    _dataReady = false;
+}
+
+void IRAM_ATTR MultizoneTofSensor::on_data_ready(void* arg) {
+    auto* instance = static_cast<MultizoneTofSensor*>(arg);
+    portENTER_CRITICAL_ISR(&instance->_dataReadyLock);
+    instance->_dataReadyUs = micros64();
+    portEXIT_CRITICAL_ISR(&instance->_dataReadyLock);
+    instance->_dataReady = true;
+    if (instance->_taskHandle == nullptr) {
+        return;
+    }
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(instance->_taskHandle, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+void MultizoneTofSensor::register_task(TaskHandle_t task_handle) {
+    _taskHandle = task_handle;
+}
+
+uint32_t MultizoneTofSensor::get_wait_ms() const {
+    if (_interruptAttached) {
+        return INTERRUPT_IDLE_WAIT_MS;
+    }
+    return POLL_WAIT_MS;
+}
+
+bool MultizoneTofSensor::consume_data_ready() {
+    if (_dataReady.exchange(false)) {
+        return true;
+    }
+    // An edge that landed while ranging was being (re)started leaves INT held low with no notification - pick it up
+    // on the idle wake instead of waiting for the watchdog
+    if (digitalRead(MULTIZONE_TOF_INT_PIN) == LOW) {
+        portENTER_CRITICAL(&_dataReadyLock);
+        _dataReadyUs = micros64(); // Edge time is lost; now is the best bound
+        portEXIT_CRITICAL(&_dataReadyLock);
+        return true;
+    }
+    return false;
+}
+
+uint64_t MultizoneTofSensor::get_data_ready_us() {
+    portENTER_CRITICAL(&_dataReadyLock);
+    const uint64_t DATA_READY_US = _dataReadyUs;
+    portEXIT_CRITICAL(&_dataReadyLock);
+    return DATA_READY_US;
+}
+
 void MultizoneTofSensor::turn_off_sensor() {
+    detach_data_ready_interrupt();
     stop_ranging();
     _sensor.vl53l7cx_set_power_mode(VL53L7CX_POWER_MODE_SLEEP);
     _sensorActive = false;
@@ -307,7 +394,7 @@ void MultizoneTofSensor::turn_off_sensor() {
     initialize_point_histories();
 }
 
-float MultizoneTofSensor::calculate_front_distance(const VL53L7CX_ResultsData& raw_data) {
+float MultizoneTofSensor::calculate_front_distance(const VL53L7CX_RangingFrame& frame) {
     MultizoneTofSensor& instance = MultizoneTofSensor::get_instance();
     float min_distance = 9999.0f; // Start with very large value
     bool found_valid_reading = false;
@@ -322,9 +409,9 @@ float MultizoneTofSensor::calculate_front_distance(const VL53L7CX_ResultsData& r
         const int INDEX = (ROW * 8) + COL;
 
         // Check if we have valid data for this point
-        if (raw_data.nb_target_detected[INDEX] > 0) {
-            const uint16_t DISTANCE = raw_data.distance_mm[INDEX];
-            const uint8_t STATUS = raw_data.target_status[INDEX];
+        if (frame.nb_target_detected[INDEX] > 0) {
+            const uint16_t DISTANCE = frame.distance_mm[INDEX];
+            const uint8_t STATUS = frame.target_status[INDEX];
 
             // Apply same filtering as obstacle detection
             if (DISTANCE <= instance._MAX_DISTANCE && DISTANCE >= instance._MIN_DISTANCE && STATUS >= instance._SIGNAL_THRESHOLD) {
@@ -2,9 +2,12 @@
 #include <Wire.h>
 #include <vl53l7cx_class.h>
 
+#include <atomic>
+
 #include "networking/serial_queue_manager.h"
 #include "sensor_data_buffer.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/singleton.h"
 #include "utils/utils.h"
 
@@ -27,6 +30,7 @@ class MultizoneTofSensor : public Singleton<MultizoneTofSensor> {
 
     void turn_off_sensor();
     VL53L7CX _sensor;
+    I2cDevice _busDevice{I2cBusId::BUS_1, VL53L7CX_DEFAULT_I2C_ADDRESS >> 1, "MultizoneTOF"};
     static bool configure_sensor();
     bool reset_sensor();
     static bool check_watchdog();
@@ -36,6 +40,15 @@ class MultizoneTofSensor : public Singleton<MultizoneTofSensor> {
     void start_ranging();
     void stop_ranging();
 
+    // Data-ready interrupt: the ISR only notifies the TOF task, which then reads the frame without polling first
+    void attach_data_ready_interrupt();
+    void detach_data_ready_interrupt();
+    static void on_data_ready(void* arg);
+    void register_task(TaskHandle_t task_handle);
+    uint32_t get_wait_ms() const;
+    bool consume_data_ready();
+    uint64_t get_data_ready_us();
+
     bool _isInitialized = false;
     bool _sensorEnabled = false; // Track if sensor is actively enabled
 
@@ -43,8 +56,8 @@ class MultizoneTofSensor : public Singleton<MultizoneTofSensor> {
     void initialize_point_histories();
     static void update_point_history(int row_index, int col_index, float distance);
     static bool is_point_obstacle_consistent(int row_index, int col_index);
-    bool process_obstacle_detection(const VL53L7CX_ResultsData& raw_data) const;
-    static float calculate_front_distance(const VL53L7CX_ResultsData& raw_data);
+    bool process_obstacle_detection(const VL53L7CX_RangingFrame& frame) const;
+    static float calculate_front_distance(const VL53L7CX_RangingFrame& frame);
 
     // Configuration parameters
     uint16_t _MAX_DISTANCE = 1000;                     // Maximum valid distance (mm)
@@ -57,6 +70,10 @@ class MultizoneTofSensor : public Singleton<MultizoneTofSensor> {
     uint8_t _SHARPENER_PERCENT = 100;                  // Sharpener percentage (0-99)
     uint32_t _INTEGRATION_TIME_MS = 5;                 // Integration time in milliseconds
 
+    // Runtime output profile: only the blocks obstacle detection and the distance grid read. The build-time profile
+    // (VL53L7CX_DISABLE_* in vl53l7cx_platform_config_default.h) already compiles the rest out; this one can narrow it further
+    uint32_t _OUTPUT_ENABLES = VL53L7CX_OUTPUT_NB_TARGET_DETECTED | VL53L7CX_OUTPUT_DISTANCE_MM | VL53L7CX_OUTPUT_TARGET_STATUS;
+
     // Temporal tracking variables for weighted average
     static const uint8_t HISTORY_SIZE = 2;
 
@@ -77,5 +94,13 @@ class MultizoneTofSensor : public Singleton<MultizoneTofSensor> {
     void update_sensor_data(); // Single read, write to buffer
     static bool should_be_polling();
 
-    static const uint16_t CHECK_SENSOR_TIME = 20; // ms
+    static const uint16_t CHECK_SENSOR_TIME = 20;      // ms, polling mode only
+    static const uint16_t POLL_WAIT_MS = 5;            // Task sleep between polls
+    static const uint16_t INTERRUPT_IDLE_WAIT_MS = 50; // Longest sleep with the interrupt, so enable/disable and the watchdog still run
+
+    TaskHandle_t _taskHandle = nullptr;
+    bool _interruptAttached = false;
+    std::atomic<bool> _dataReady{false};
+    uint64_t _dataReadyUs = 0; // micros64() at the last INT edge, under _dataReadyLock (a 64-bit access is not atomic)
+    portMUX_TYPE _dataReadyLock = portMUX_INITIALIZER_UNLOCKED;
 };
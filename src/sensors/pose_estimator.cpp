@@ -0,0 +1,114 @@
+#include "pose_estimator.h"
+
+#include <cmath>
+
+namespace {
+float wrap_radians(float angle) {
+    while (angle > PI) {
+        angle -= 2.0f * PI;
+    }
+    while (angle < -PI) {
+        angle += 2.0f * PI;
+    }
+    return angle;
+}
+} // namespace
+
+void PoseEstimator::reset(float x_in, float y_in, float heading_deg) {
+    // Applied by the encoder task on its next update, so the pose is only ever written from one place
+    portENTER_CRITICAL(&_resetLock);
+    _resetX = x_in;
+    _resetY = y_in;
+    _resetHeadingRad = heading_deg * DEG_TO_RAD;
+    _resetRequested = true;
+    portEXIT_CRITICAL(&_resetLock);
+}
+
+void PoseEstimator::update(const EncoderData& encoder) {
+    portENTER_CRITICAL(&_resetLock);
+    const bool RESET_REQUESTED = _resetRequested;
+    _resetRequested = false;
+    portEXIT_CRITICAL(&_resetLock);
+
+    if (RESET_REQUESTED) {
+        _x = _resetX;
+        _y = _resetY;
+        _headingAtImuRad = _resetHeadingRad;
+        _encoderRotationSinceImu = 0.0f;
+        _hasImuBaseline = false; // Next yaw sample is the new reference
+    }
+
+    if (!_hasEncoderBaseline) {
+        _lastLeftCount = encoder.left_encoder_count;
+        _lastRightCount = encoder.right_encoder_count;
+        _hasEncoderBaseline = true;
+        return;
+    }
+
+    const float LEFT_DISTANCE = static_cast<float>(encoder.left_encoder_count - _lastLeftCount) * INCHES_PER_COUNT;
+    const float RIGHT_DISTANCE = static_cast<float>(encoder.right_encoder_count - _lastRightCount) * INCHES_PER_COUNT;
+    _lastLeftCount = encoder.left_encoder_count;
+    _lastRightCount = encoder.right_encoder_count;
+
+    const float DISTANCE = (LEFT_DISTANCE + RIGHT_DISTANCE) / 2.0f;
+    const float PREVIOUS_HEADING = _headingAtImuRad + _encoderRotationSinceImu;
+    _encoderRotationSinceImu += (RIGHT_DISTANCE - LEFT_DISTANCE) / TRACK_WIDTH_IN;
+
+    // Complementary filter on the rotation since the last yaw sample
+    float imu_rotation = 0.0f;
+    const bool IMU_FUSED = take_imu_rotation(imu_rotation);
+    if (IMU_FUSED) {
+        _headingAtImuRad += (IMU_HEADING_WEIGHT * imu_rotation) + ((1.0f - IMU_HEADING_WEIGHT) * _encoderRotationSinceImu);
+        _encoderRotationSinceImu = 0.0f;
+    }
+    _headingAtImuRad = wrap_radians(_headingAtImuRad);
+    const float HEADING = wrap_radians(_headingAtImuRad + _encoderRotationSinceImu);
+
+    // Advance along the mid-step heading
+    const float MID_HEADING = PREVIOUS_HEADING + (wrap_radians(HEADING - PREVIOUS_HEADING) / 2.0f);
+    _x += DISTANCE * cosf(MID_HEADING);
+    _y += DISTANCE * sinf(MID_HEADING);
+
+    // Speeds from the encoders' filtered wheel rates
+    const float INCHES_PER_SECOND_PER_RPM = EncoderManager::WHEEL_CIRCUMFERENCE_IN / 60.0f;
+    const float LEFT_SPEED = encoder.left_wheel_rpm * INCHES_PER_SECOND_PER_RPM;
+    const float RIGHT_SPEED = encoder.right_wheel_rpm * INCHES_PER_SECOND_PER_RPM;
+
+    PoseData pose;
+    pose.x_in = _x;
+    pose.y_in = _y;
+    pose.heading_deg = HEADING * RAD_TO_DEG;
+    pose.velocity_in_per_s = (LEFT_SPEED + RIGHT_SPEED) / 2.0f;
+    pose.angular_velocity_deg_per_s = ((RIGHT_SPEED - LEFT_SPEED) / TRACK_WIDTH_IN) * RAD_TO_DEG;
+    pose.is_imu_fused = _hasImuBaseline && static_cast<int64_t>(encoder.timestampUs - _lastYawUs) <= IMU_MAX_GAP_US;
+    pose.is_valid = true;
+    pose.timestampUs = encoder.timestampUs;
+
+    SensorDataBuffer::get_instance().update_pose_data(pose);
+}
+
+bool PoseEstimator::take_imu_rotation(float& rotation_rad) {
+    // Straight from the buffer: reading through the getter would keep the quaternion report alive on its own. Pose
+    // readers do that instead (get_latest_pose), so fusion runs only while someone wants the pose
+    const EulerAngles EULER = SensorDataBuffer::get_instance()._current_sample.euler_angles;
+    if (!EULER.isValid || EULER.timestampUs == _lastYawUs) {
+        return false;
+    }
+
+    const bool CONTINUOUS = _hasImuBaseline && (EULER.timestampUs - _lastYawUs) <= IMU_MAX_GAP_US;
+    const float YAW_CHANGE = EULER.yaw - _lastYawDeg;
+    _lastYawDeg = EULER.yaw;
+    _lastYawUs = EULER.timestampUs;
+
+    if (!CONTINUOUS) {
+        // First sample, or the reports were off for a while: what the encoders tracked meanwhile stands, and this
+        // sample becomes the reference for the next one
+        _headingAtImuRad += _encoderRotationSinceImu;
+        _encoderRotationSinceImu = 0.0f;
+        _hasImuBaseline = true;
+        return false;
+    }
+
+    rotation_rad = wrap_radians(YAW_CHANGE * DEG_TO_RAD);
+    return true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+
+#include "encoder_manager.h"
+#include "sensor_data_buffer.h"
+#include "utils/singleton.h"
+
+// Dead-reckoning pose from differential-drive odometry, run once per encoder update. Wheel counts give distance and a
+// heading change; the heading change is blended with the IMU's game-rotation yaw whenever a fresh yaw sample is in the
+// buffer (complementary filter - the IMU for rotation, which wheel slip corrupts, the encoders for everything else).
+// With no fresh yaw (quaternion reports off) it keeps going on encoders alone.
+class PoseEstimator : public Singleton<PoseEstimator> {
+    friend class Singleton<PoseEstimator>;
+    friend class EncoderManager;
+
+  public:
+    // Re-zero the pose: (x, y) in inches, heading in degrees, counter-clockwise positive
+    void reset(float x_in = 0.0f, float y_in = 0.0f, float heading_deg = 0.0f);
+
+  private:
+    PoseEstimator() = default;
+
+    // Encoder task, right after the encoder data is published
+    void update(const EncoderData& encoder);
+
+    // Yaw since the last fused sample; rebaselines instead if the IMU went quiet
+    bool take_imu_rotation(float& rotation_rad);
+
+    static constexpr float TRACK_WIDTH_IN = 3.15f;     // Wheel contact center to center
+    static constexpr float IMU_HEADING_WEIGHT = 0.98f; // Share of each heading change taken from the IMU
+    static constexpr uint32_t IMU_MAX_GAP_US = 100000; // Longer between yaw samples: don't fuse across the gap
+    static constexpr float INCHES_PER_COUNT =
+        EncoderManager::WHEEL_CIRCUMFERENCE_IN / (static_cast<float>(EncoderManager::PULSES_PER_REVOLUTION) * EncoderManager::GEAR_RATIO);
+
+    bool _hasEncoderBaseline = false;
+    int64_t _lastLeftCount = 0;
+    int64_t _lastRightCount = 0;
+
+    bool _hasImuBaseline = false;
+    float _lastYawDeg = 0.0f;
+    uint64_t _lastYawUs = 0;
+    float _headingAtImuRad = 0.0f;         // Fused heading as of the last yaw sample
+    float _encoderRotationSinceImu = 0.0f; // Encoder-only heading change since then
+
+    float _x = 0.0f;
+    float _y = 0.0f;
+    bool _resetRequested = false;
+    float _resetX = 0.0f;
+    float _resetY = 0.0f;
+    float _resetHeadingRad = 0.0f;
+    portMUX_TYPE _resetLock = portMUX_INITIALIZER_UNLOCKED;
+};
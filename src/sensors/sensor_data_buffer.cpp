@@ -8,30 +8,26 @@
 using color_types::ColorType;
 
 // IMU update methods (existing)
-void SensorDataBuffer::update_quaternion(const QuaternionData& quaternion) {
-    _current_sample.quaternion = quaternion;
-    // Update derived Euler angles if quaternion is valid
-    if (quaternion.isValid) {
+void SensorDataBuffer::update_imu_batch(const ImuSample& batch, uint32_t event_count) {
+    if (batch.quaternion.isValid) {
+        const QuaternionData& quaternion = batch.quaternion;
+        _current_sample.quaternion = quaternion;
+        // Update derived Euler angles
         quaternion_to_euler(quaternion.qW, quaternion.qX, quaternion.qY, quaternion.qZ, _current_sample.euler_angles.yaw,
                             _current_sample.euler_angles.pitch, _current_sample.euler_angles.roll);
         _current_sample.euler_angles.isValid = true;
+        _current_sample.euler_angles.timestampUs = quaternion.timestampUs;
     }
-    mark_imu_data_updated();
-}
-
-void SensorDataBuffer::update_accelerometer(const AccelerometerData& accel) {
-    _current_sample.accelerometer = accel;
-    mark_imu_data_updated();
-}
-
-void SensorDataBuffer::update_gyroscope(const GyroscopeData& gyro) {
-    _current_sample.gyroscope = gyro;
-    mark_imu_data_updated();
-}
-
-void SensorDataBuffer::update_magnetometer(const MagnetometerData& mag) {
-    _current_sample.magnetometer = mag;
-    mark_imu_data_updated();
+    if (batch.accelerometer.isValid) {
+        _current_sample.accelerometer = batch.accelerometer;
+    }
+    if (batch.gyroscope.isValid) {
+        _current_sample.gyroscope = batch.gyroscope;
+    }
+    if (batch.magnetometer.isValid) {
+        _current_sample.magnetometer = batch.magnetometer;
+    }
+    mark_imu_data_updated(event_count);
 }
 
 // TOF update method (existing)
@@ -58,6 +54,10 @@ void SensorDataBuffer::update_encoder_data(const EncoderData& encoder) {
     mark_encoder_data_updated();
 }
 
+void SensorDataBuffer::update_pose_data(const PoseData& pose) {
+    _current_pose_data = pose;
+}
+
 // IMU Read methods - reset timeouts when called (existing)
 EulerAngles SensorDataBuffer::get_latest_euler_angles() const {
     _timeouts.quaternion_last_request.store(millis());
@@ -90,9 +90,9 @@ TofData SensorDataBuffer::get_latest_tof_data() {
     return _current_tof_data;
 }
 
-VL53L7CX_ResultsData SensorDataBuffer::get_latest_tof_raw_data() const {
+VL53L7CX_RangingFrame SensorDataBuffer::get_latest_tof_frame() const {
     _timeouts.tof_last_request.store(millis());
-    return _current_tof_data.raw_data;
+    return _current_tof_data.frame;
 }
 
 bool SensorDataBuffer::is_object_detected_tof() const {
@@ -121,6 +121,16 @@ uint16_t SensorDataBuffer::get_latest_right_side_tof_counts() const {
     return _current_side_tof_data.right_counts;
 }
 
+bool SensorDataBuffer::is_left_side_object_near() const {
+    _timeouts.side_tof_last_request.store(millis());
+    return _current_side_tof_data.left_near;
+}
+
+bool SensorDataBuffer::is_right_side_object_near() const {
+    _timeouts.side_tof_last_request.store(millis());
+    return _current_side_tof_data.right_near;
+}
+
 bool SensorDataBuffer::is_left_side_tof_valid() const {
     _timeouts.side_tof_last_request.store(millis());
     return _current_side_tof_data.left_valid;
@@ -198,6 +208,11 @@ std::pair<int64_t, int64_t> SensorDataBuffer::get_latest_encoder_counts() {
     return std::make_pair(_current_encoder_data.left_encoder_count, _current_encoder_data.right_encoder_count);
 }
 
+PoseData SensorDataBuffer::get_latest_pose() const {
+    _timeouts.quaternion_last_request.store(millis());
+    return _current_pose_data;
+}
+
 // Convenience methods for individual values (existing)
 float SensorDataBuffer::get_latest_pitch() const {
     return get_latest_euler_angles().roll; // Note: roll maps to pitch in your system
@@ -298,9 +313,9 @@ void SensorDataBuffer::stop_polling_sensor(SensorType sensor_type) {
     }
 }
 
-void SensorDataBuffer::mark_imu_data_updated() {
+void SensorDataBuffer::mark_imu_data_updated(uint32_t sample_count) {
     _last_imu_update_time.store(millis());
-    _imu_update_count.fetch_add(1); // Increment frequency counter
+    _imu_update_count.fetch_add(sample_count); // Frequency counts reports, not batches
 }
 
 void SensorDataBuffer::mark_tof_data_updated() {
@@ -345,9 +360,7 @@ float SensorDataBuffer::get_imu_frequency() {
         last_frequency = static_cast<float>(update_delta) * 1000.0f / static_cast<float>(time_delta);
 
         // Debug logging
-        char debug_buffer[128];
-        snprintf(debug_buffer, sizeof(debug_buffer), "DEBUG: updateDelta=%u, timeDelta=%u, freq=%.1f", update_delta, time_delta, last_frequency);
-        SerialQueueManager::get_instance().queue_message(debug_buffer);
+        SerialQueueManager::get_instance().log(LogFormat::IMU_UPDATE_FREQUENCY_DEBUG, update_delta, time_delta, last_frequency);
 
         // Update tracking variables
         _last_imu_frequency_calc_time.store(CURRENT_TIME);
@@ -473,95 +486,38 @@ bool SensorDataBuffer::should_enable_quaternion_extended() {
 }
 
 ColorType SensorDataBuffer::classify_current_color() const {
-    uint8_t r = _current_color_data.red_value;
-    uint8_t g = _current_color_data.green_value;
-    uint8_t b = _current_color_data.blue_value;
-
+    // Classified and debounced once per sample by the color sensor task
     if (!_current_color_data.is_valid) {
         return ColorType::COLOR_NONE;
     }
-
-    // White: All components bright
-    if (r > 130 && g > 130 && b > 130) {
-        return ColorType::COLOR_WHITE;
-    }
-
-    // Yellow: Red and Green strong, Blue weak
-    if (r > 120 && g > 120 && b < 100) {
-        return ColorType::COLOR_YELLOW;
-    }
-
-    // Red: R dominant and bright enough
-    if (r > 80 && r > (g + 30) && r > (b + 30)) {
-        return ColorType::COLOR_RED;
-    }
-
-    // Green: G dominant and bright enough
-    if (g > 65 && g > (r + 20) && g > (b + 20)) {
-        return ColorType::COLOR_GREEN;
-    }
-
-    // Blue: B dominant and bright enough
-    if (b > 65 && b > (r + 20) && b > (g + 20)) {
-        return ColorType::COLOR_BLUE;
-    }
-
-    // Black: All components dark
-    if (r < 60 && g < 60 && b < 60) {
-        return ColorType::COLOR_BLACK;
-    }
-
-    return ColorType::COLOR_NONE;
+    return _current_color_data.color_class;
 }
 
-void SensorDataBuffer::update_color_history(ColorType color) {
-    _color_history[_color_history_index] = color;
-    _color_history_index = (_color_history_index + 1) % 5;
+bool SensorDataBuffer::is_object_color(ColorType color) const {
+    _timeouts.color_last_request.store(millis());
+    return classify_current_color() == color;
 }
 
-bool SensorDataBuffer::check_color_consistency(ColorType target_color) {
-    // Count how many of the last 5 classifications match the target
-    uint8_t match_count = 0;
-    for (auto& i : _color_history) {
-        if (i == target_color) {
-            match_count++;
-        }
-    }
-    return match_count >= 4; // Need 4 out of 5 to confirm
+bool SensorDataBuffer::is_object_red() const {
+    return is_object_color(ColorType::COLOR_RED);
 }
 
-bool SensorDataBuffer::is_object_red() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_RED);
+bool SensorDataBuffer::is_object_green() const {
+    return is_object_color(ColorType::COLOR_GREEN);
 }
 
-bool SensorDataBuffer::is_object_green() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_GREEN);
+bool SensorDataBuffer::is_object_blue() const {
+    return is_object_color(ColorType::COLOR_BLUE);
 }
 
-bool SensorDataBuffer::is_object_blue() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_BLUE);
+bool SensorDataBuffer::is_object_white() const {
+    return is_object_color(ColorType::COLOR_WHITE);
 }
 
-bool SensorDataBuffer::is_object_white() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_WHITE);
+bool SensorDataBuffer::is_object_black() const {
+    return is_object_color(ColorType::COLOR_BLACK);
 }
 
-bool SensorDataBuffer::is_object_black() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_BLACK);
-}
-
-bool SensorDataBuffer::is_object_yellow() {
-    _timeouts.color_last_request.store(millis());
-    update_color_history(classify_current_color());
-    return check_color_consistency(ColorType::COLOR_YELLOW);
+bool SensorDataBuffer::is_object_yellow() const {
+    return is_object_color(ColorType::COLOR_YELLOW);
 }
@@ -20,15 +20,16 @@ class BytecodeVM;
 
 // TOF sensor data structure
 struct TofData {
-    VL53L7CX_ResultsData raw_data{};
+    VL53L7CX_RangingFrame frame{}; // Slim readout - only the blocks in the sensor's output profile
     bool is_object_detected = false;
     bool is_valid = false;
     float front_distance = -1.0f; // Minimum distance from front-facing zones (inches), -1 if invalid
-    uint32_t timestamp = 0;
+    uint8_t stream_count = 0;     // Sensor's frame counter - a jump of more than one means frames were missed
+    uint64_t timestampUs = 0;     // micros64() at data-ready: the INT edge when wired, else the poll that saw it
 
     TofData() {
-        // Initialize raw_data to safe defaults
-        memset(&raw_data, 0, sizeof(VL53L7CX_ResultsData));
+        // Initialize frame to safe defaults
+        memset(&frame, 0, sizeof(VL53L7CX_RangingFrame));
     }
 };
 
@@ -38,7 +39,12 @@ struct SideTofData {
     uint16_t right_counts = 0;
     bool left_valid = false;
     bool right_valid = false;
-    uint32_t timestamp = 0;
+    // Proximity state: set above the sensor's enter threshold, cleared below its exit threshold
+    bool left_near = false;
+    bool right_near = false;
+    uint64_t left_changed_us = 0; // micros64() of the reading that last entered or exited
+    uint64_t right_changed_us = 0;
+    uint64_t timestampUs = 0; // micros64() when the later of the two reads came off the bus
 };
 
 // Color sensor data structure (using existing ColorSensorData from structs.h)
@@ -47,7 +53,9 @@ struct ColorData {
     uint8_t green_value = 0;
     uint8_t blue_value = 0;
     bool is_valid = false;
-    uint32_t timestamp = 0;
+    ColorType color_class = ColorType::COLOR_NONE; // Debounced: at least 4 of the last 5 samples agree, else COLOR_NONE
+    uint8_t class_confidence = 0;                  // Percent of the last 5 samples in the most common class
+    uint64_t timestampUs = 0;                      // micros64() when the channel reads came off the bus
 };
 
 // Encoder data structure
@@ -58,7 +66,19 @@ struct EncoderData {
     int64_t left_encoder_count = 0;  // Raw encoder count from _leftEncoder.getCount()
     int64_t right_encoder_count = 0; // Raw encoder count from _rightEncoder.getCount()
     bool is_valid = false;
-    uint32_t timestamp = 0;
+    uint64_t timestampUs = 0; // micros64() at the count read
+};
+
+// Dead-reckoning pose (PoseEstimator), relative to where the encoders started or the last reset
+struct PoseData {
+    float x_in = 0.0f;        // Forward at heading 0
+    float y_in = 0.0f;        // Left at heading 0
+    float heading_deg = 0.0f; // Counter-clockwise positive, -180 to 180
+    float velocity_in_per_s = 0.0f;
+    float angular_velocity_deg_per_s = 0.0f;
+    bool is_imu_fused = false; // Heading is tracking IMU yaw (false: encoders only)
+    bool is_valid = false;
+    uint64_t timestampUs = 0; // Of the encoder sample it was computed from
 };
 
 // Combined sensor data structure
@@ -156,6 +176,7 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
     friend class SideTofManager;
     friend class ColorSensor;    // Add color sensor as friend
     friend class EncoderManager; // Add EncoderManager as friend
+    friend class PoseEstimator;
 
   public:
     // IMU Read methods (called from any core, resets timeouts)
@@ -167,7 +188,7 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
 
     // TOF Read methods (called from any core, resets timeouts)
     TofData get_latest_tof_data();
-    VL53L7CX_ResultsData get_latest_tof_raw_data() const;
+    VL53L7CX_RangingFrame get_latest_tof_frame() const;
     bool is_object_detected_tof() const;
     float get_front_tof_distance() const;
 
@@ -177,6 +198,8 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
     uint16_t get_latest_right_side_tof_counts() const;
     bool is_left_side_tof_valid() const;
     bool is_right_side_tof_valid() const;
+    bool is_left_side_object_near() const;
+    bool is_right_side_object_near() const;
 
     // Color sensor Read methods (called from any core, resets timeouts)
     ColorData get_latest_color_data();
@@ -198,6 +221,9 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
     int64_t get_latest_right_encoder_count() const;
     std::pair<int64_t, int64_t> get_latest_encoder_counts(); // Both counts atomically
 
+    // Pose Read method (called from any core). Keeps the quaternion report on, so the heading stays IMU-fused
+    PoseData get_latest_pose() const;
+
     // Convenience methods for individual values
     float get_latest_pitch() const;
     float get_latest_yaw() const;
@@ -238,26 +264,26 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
 
     bool should_enable_quaternion_extended();
 
-    bool is_object_red();
-    bool is_object_green();
-    bool is_object_blue();
-    bool is_object_white();
-    bool is_object_black();
-    bool is_object_yellow();
+    // Debounced color class published by the color sensor task; reading it keeps the sensor on
+    bool is_object_red() const;
+    bool is_object_green() const;
+    bool is_object_blue() const;
+    bool is_object_white() const;
+    bool is_object_black() const;
+    bool is_object_yellow() const;
     ColorType classify_current_color() const;
 
   private:
     SensorDataBuffer() = default;
 
     // Write methods (called by sensor polling task on Core 0)
-    void update_quaternion(const QuaternionData& quaternion);
-    void update_accelerometer(const AccelerometerData& accel);
-    void update_gyroscope(const GyroscopeData& gyro);
-    void update_magnetometer(const MagnetometerData& mag);
+    // One IMU wake-up's worth of reports: only the types marked valid in the batch replace the current values
+    void update_imu_batch(const ImuSample& batch, uint32_t event_count);
     void update_tof_data(const TofData& tof);
     void update_side_tof_data(const SideTofData& side_tof);
     void update_color_data(const ColorData& color);       // Add color sensor update method
     void update_encoder_data(const EncoderData& encoder); // Add encoder update method
+    void update_pose_data(const PoseData& pose);
 
     // Thread-safe data storage
     ImuSample _current_sample;
@@ -265,6 +291,7 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
     SideTofData _current_side_tof_data;
     ColorData _current_color_data;     // Add color sensor data storage
     EncoderData _current_encoder_data; // Add encoder data storage
+    PoseData _current_pose_data;
 
     std::atomic<uint32_t> _last_imu_update_time{0};
     std::atomic<uint32_t> _last_tof_update_time{0};
@@ -286,16 +313,11 @@ class SensorDataBuffer : public Singleton<SensorDataBuffer> {
     std::atomic<uint32_t> _last_color_sensor_frequency_calc_time{0};
 
     // Helper to update timestamp
-    void mark_imu_data_updated();
+    void mark_imu_data_updated(uint32_t sample_count);
     void mark_tof_data_updated();
     void mark_side_tof_data_updated();
     void mark_color_data_updated();   // Separate method for color sensor timestamp
     void mark_encoder_data_updated(); // Separate method for encoder timestamp
 
-    ColorType _color_history[5] = {ColorType::COLOR_NONE}; // Circular buffer for last 5 classifications
-    uint8_t _color_history_index = 0;
-
-    // Helper methods
-    void update_color_history(ColorType color);
-    bool check_color_consistency(ColorType target_color);
+    bool is_object_color(ColorType color) const;
 };
@@ -1,5 +1,6 @@
 #include "sensor_initializer.h"
 
+#include "utils/task_manager.h"
 #include "utils/utils.h"
 
 // TODO 8/21/25: Consider moving all sensor initialization to the individual sensor level.
@@ -9,17 +10,20 @@ SensorInitializer::SensorInitializer() {
     // Initialize the status array
     for (int i = 0; i < SENSOR_COUNT; i++) {
         _sensorInitialized[i] = false;
+        _initSucceeded[i] = false;
     }
 
     SerialQueueManager::get_instance().queue_message("Starting centralized sensor initialization...");
 
-    // Initialize sensors sequentially to avoid I2C conflicts
-    // Start with the heaviest I2C user first (multizone requires ~84KB data transfer)
-    initialize_multizone_tof();
+    // The multizone TOF is the heaviest I2C user (~84KB firmware upload), so it runs on its own task while the IMU
+    // initializes on Wire1; the color sensor shares Wire with it, and its transactions interleave with the upload's
+    if (!TaskManager::create_multizone_tof_init_task(this)) {
+        initialize_multizone_tof(); // No room for the task - upload inline, as before
+    }
     initialize_imu();
     initialize_color_sensor();
 
-    SerialQueueManager::get_instance().queue_message("Centralized sensor initialization complete");
+    SerialQueueManager::get_instance().queue_message("Centralized sensor initialization complete (multizone TOF may still be uploading)");
 }
 
 bool SensorInitializer::is_sensor_initialized(SensorType sensor) {
@@ -29,35 +33,54 @@ bool SensorInitializer::is_sensor_initialized(SensorType sensor) {
     return false;
 }
 
+void SensorInitializer::finish_initialization(SensorType sensor, uint32_t start_ms, bool success) {
+    _initDurationMs[sensor] = millis() - start_ms;
+    _initSucceeded[sensor] = success;
+    _sensorInitialized[sensor] = success;
+
+    if (_pendingInitializations.fetch_sub(1) != 1) {
+        return;
+    }
+    SerialQueueManager::get_instance().log(LogFormat::SENSOR_INIT_TIMING, _initDurationMs[MULTIZONE_TOF], _initSucceeded[MULTIZONE_TOF].load(),
+                                           _initDurationMs[IMU], _initSucceeded[IMU].load(), _initDurationMs[COLOR_SENSOR],
+                                           _initSucceeded[COLOR_SENSOR].load());
+}
+
 void SensorInitializer::initialize_multizone_tof() {
     SerialQueueManager::get_instance().queue_message("Initializing Multizone sensor...");
+    const uint32_t START_MS = millis();
 
     if (!MultizoneTofSensor::get_instance().initialize()) {
         SerialQueueManager::get_instance().queue_message("Multizone sensor initialization failed");
+        finish_initialization(MULTIZONE_TOF, START_MS, false);
         return;
     }
     SerialQueueManager::get_instance().queue_message("Multizone sensor setup complete");
-    _sensorInitialized[MULTIZONE_TOF] = true;
+    finish_initialization(MULTIZONE_TOF, START_MS, true);
 }
 
 void SensorInitializer::initialize_imu() {
     SerialQueueManager::get_instance().queue_message("Initializing IMU...");
+    const uint32_t START_MS = millis();
 
     if (!ImuSensor::get_instance().initialize()) {
         SerialQueueManager::get_instance().queue_message("IMU initialization failed");
+        finish_initialization(IMU, START_MS, false);
         return;
     }
     SerialQueueManager::get_instance().queue_message("IMU setup complete");
-    _sensorInitialized[IMU] = true;
+    finish_initialization(IMU, START_MS, true);
 }
 
 void SensorInitializer::initialize_color_sensor() {
     SerialQueueManager::get_instance().queue_message("Initializing Color Sensor...");
+    const uint32_t START_MS = millis();
 
     if (!ColorSensor::get_instance().initialize()) {
         SerialQueueManager::get_instance().queue_message("Color Sensor initialization failed");
+        finish_initialization(COLOR_SENSOR, START_MS, false);
         return;
     }
     SerialQueueManager::get_instance().queue_message("Color Sensor setup complete");
-    _sensorInitialized[COLOR_SENSOR] = true;
+    finish_initialization(COLOR_SENSOR, START_MS, true);
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include <atomic>
+
 #include "color_sensor.h"
 #include "imu.h"
 #include "multizone_tof_sensor.h"
@@ -28,5 +30,12 @@ class SensorInitializer : public Singleton<SensorInitializer> {
     void initialize_imu();
     void initialize_color_sensor();
 
-    bool _sensorInitialized[SENSOR_COUNT]{};
+    // Records how long one sensor took; the last one to finish logs all the timings
+    void finish_initialization(SensorType sensor, uint32_t start_ms, bool success);
+
+    // Multizone TOF initializes on its own task, so these are written from two tasks
+    std::atomic<bool> _sensorInitialized[SENSOR_COUNT];
+    std::atomic<bool> _initSucceeded[SENSOR_COUNT];
+    std::atomic<uint8_t> _pendingInitializations{SENSOR_COUNT};
+    uint32_t _initDurationMs[SENSOR_COUNT]{};
 };
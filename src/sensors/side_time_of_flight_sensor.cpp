@@ -2,10 +2,7 @@
 
 #include <algorithm>
 
-bool SideTimeOfFlightSensor::initialize(const uint8_t TOF_ADDRESS) {
-    // Save the sensor address to the class member variable
-    _sensorAddress = TOF_ADDRESS;
-
+bool SideTimeOfFlightSensor::initialize() {
     // Add a delay before trying to initialize
     vTaskDelay(pdMS_TO_TICKS(50));
 
@@ -30,6 +27,8 @@ bool SideTimeOfFlightSensor::initialize(const uint8_t TOF_ADDRESS) {
                 SerialQueueManager::get_instance().queue_message("No calibration found - performing auto-calibration");
                 perform_calibration();
             }
+            load_thresholds_from_preferences();
+            configure_threshold_interrupt();
 
             return true;
         }
@@ -40,44 +39,21 @@ bool SideTimeOfFlightSensor::initialize(const uint8_t TOF_ADDRESS) {
     return false;
 }
 
-// NEW: Buffer-based sensor data update method
-void SideTimeOfFlightSensor::update_sensor_data() {
-    // Only try to read if sensor is initialized
+bool SideTimeOfFlightSensor::request_proximity_data() {
     if (!_isInitialized) {
-        return;
+        return false;
     }
-
-    // Skip rate limiting entirely for maximum performance like performance test
-    const uint32_t CURRENT_TIME = millis();
-    uint32_t elapsed_time = CURRENT_TIME - _lastUpdateTime;
-    if (elapsed_time < DELAY_BETWEEN_READINGS) {
-        return;
+    if (!_proximityRead.is_done()) {
+        return true; // Previous read still queued (it outlived its wait) - collect that one instead
     }
-
-    // Read current sensor data with no throttling
-    uint16_t counts = read_proximity_data();
-    _lastUpdateTime = CURRENT_TIME;
-
-    // Note: This method is called by SideTofManager which will combine
-    // both left and right readings and write to buffer
-    // We don't write to buffer directly here since we need both sensors
+    return _busDevice.read_async(_proximityRead, VCNL36828P_PS_DATA, 2, I2cPriority::URGENT, PROXIMITY_READ_DEADLINE_MS);
 }
 
-uint16_t SideTimeOfFlightSensor::get_current_counts() {
-    // Only try to read if sensor is initialized
-    if (!_isInitialized) {
+uint16_t SideTimeOfFlightSensor::take_proximity_data(uint32_t timeout_ms) {
+    if (_busDevice.wait(_proximityRead, timeout_ms) != I2cStatus::OK) {
         return 0;
     }
-
-    const uint32_t CURRENT_TIME = millis();
-    uint32_t elapsed_time = CURRENT_TIME - _lastUpdateTime;
-
-    // Only update if enough time has passed
-    if (elapsed_time >= DELAY_BETWEEN_READINGS) {
-        _lastUpdateTime = CURRENT_TIME;
-    }
-
-    return read_proximity_data();
+    return apply_calibration(_proximityRead.word());
 }
 
 void SideTimeOfFlightSensor::basic_initialization_auto_mode() {
@@ -102,6 +78,14 @@ void SideTimeOfFlightSensor::basic_initialization_auto_mode() {
     // PS_CONF3_L
     // Set the measurement mode of the sensor
     VCNL36828P_SET_PS_MODE(_sensorAddress, VCNL36828P_PS_MODE_AUTO_MODE);
+    // PS_CONF3_H
+    // With INT wired, measure every 6.25 ms instead of every 50 ms (PS_PERIOD) so a threshold crossing is flagged
+    // within a few ms. Polled sensors are only read every 50 ms, so they keep the slower period
+    if (has_interrupt_pin()) {
+        VCNL36828P_SET_PS_SHORT_PERIOD(_sensorAddress, VCNL36828P_PS_SHORT_PERIOD_6_25ms);
+    } else {
+        VCNL36828P_SET_PS_SHORT_PERIOD(_sensorAddress, VCNL36828P_PS_SHORT_PERIOD_DIS);
+    }
 
     // 3.) Switch On the sensor
     // Enable the internal calibration
@@ -145,9 +129,10 @@ bool SideTimeOfFlightSensor::perform_calibration() {
     SerialQueueManager::get_instance().queue_message("Make sure no obstacles are in front of the sensors!");
     vTaskDelay(pdMS_TO_TICKS(3000)); // Give time to clear obstacles
 
-    uint16_t baseline = capture_baseline_reading();
+    uint16_t spread = 0;
+    uint16_t baseline = capture_baseline_reading(spread);
 
-    snprintf(log_message, sizeof(log_message), "Baseline reading: %u", baseline);
+    snprintf(log_message, sizeof(log_message), "Baseline reading: %u (spread %u)", baseline, spread);
     SerialQueueManager::get_instance().queue_message(log_message);
 
     _baselineValue = baseline;
@@ -163,31 +148,55 @@ bool SideTimeOfFlightSensor::perform_calibration() {
         SerialQueueManager::get_instance().queue_message("Using software calibration (baseline too high for hardware)");
     }
 
+    derive_thresholds(spread);
+
     // Store calibration in NVS
     PreferencesManager::get_instance().store_side_tof_calibration(_sensorAddress, _baselineValue, _useHardwareCalibration);
+    PreferencesManager::get_instance().store_side_tof_thresholds(_sensorAddress, _enterThreshold, _exitThreshold);
 
     _isCalibrated = true;
 
-    snprintf(log_message, sizeof(log_message), "Sensor 0x%02X calibrated successfully - baseline: %u", _sensorAddress, _baselineValue);
+    snprintf(log_message, sizeof(log_message), "Sensor 0x%02X calibrated successfully - baseline: %u, enter/exit: %u/%u", _sensorAddress,
+             _baselineValue, _enterThreshold, _exitThreshold);
     SerialQueueManager::get_instance().queue_message(log_message);
 
     return true;
 }
 
-uint16_t SideTimeOfFlightSensor::capture_baseline_reading() {
+uint16_t SideTimeOfFlightSensor::capture_baseline_reading(uint16_t& spread) {
     const int NUM_SAMPLES = 10;
     uint32_t sum = 0;
+    uint16_t min_reading = UINT16_MAX;
+    uint16_t max_reading = 0;
 
     // Take multiple readings and average them for better accuracy
     for (int i = 0; i < NUM_SAMPLES; i++) {
         uint16_t reading = VCNL36828P_GET_PS_DATA(_sensorAddress);
         sum += reading;
+        min_reading = std::min(min_reading, reading);
+        max_reading = std::max(max_reading, reading);
         vTaskDelay(pdMS_TO_TICKS(100)); // Small delay between readings
     }
 
+    spread = max_reading - min_reading;
     return static_cast<uint16_t>(sum / NUM_SAMPLES);
 }
 
+void SideTimeOfFlightSensor::derive_thresholds(uint16_t spread) {
+    // Calibrated readings of an empty scene sit around zero, give or take the spread seen while capturing the baseline.
+    // The exit threshold clears that noise with margin, and the enter threshold keeps the default hysteresis above it
+    const uint32_t HYSTERESIS = DEFAULT_ENTER_THRESHOLD - DEFAULT_EXIT_THRESHOLD;
+    uint32_t exit_threshold = static_cast<uint32_t>(spread) * THRESHOLD_NOISE_MARGIN;
+    if (exit_threshold < DEFAULT_EXIT_THRESHOLD) {
+        exit_threshold = DEFAULT_EXIT_THRESHOLD;
+    }
+    if (exit_threshold > UINT16_MAX - HYSTERESIS) {
+        exit_threshold = UINT16_MAX - HYSTERESIS;
+    }
+    _exitThreshold = static_cast<uint16_t>(exit_threshold);
+    _enterThreshold = static_cast<uint16_t>(exit_threshold + HYSTERESIS);
+}
+
 void SideTimeOfFlightSensor::apply_hardware_calibration(uint16_t baseline) {
     VCNL36828P_SET_PS_CANC(_sensorAddress, baseline);
 }
@@ -208,3 +217,57 @@ uint16_t SideTimeOfFlightSensor::apply_calibration(uint16_t raw_reading) const {
 
     return static_cast<uint16_t>(calibrated_reading);
 }
+
+void SideTimeOfFlightSensor::load_thresholds_from_preferences() {
+    uint16_t enter_threshold = 0;
+    uint16_t exit_threshold = 0;
+    if (!PreferencesManager::get_instance().get_side_tof_thresholds(_sensorAddress, enter_threshold, exit_threshold) ||
+        exit_threshold >= enter_threshold) {
+        return; // Keep the defaults
+    }
+    _enterThreshold = enter_threshold;
+    _exitThreshold = exit_threshold;
+}
+
+void SideTimeOfFlightSensor::configure_threshold_interrupt() {
+    // PS_THDH/PS_THDL compare against the raw reading; software calibration subtracts the baseline after it
+    uint32_t offset = 0;
+    if (_isCalibrated && !_useHardwareCalibration) {
+        offset = _baselineValue;
+    }
+    const uint16_t HIGH_THRESHOLD = static_cast<uint16_t>(std::min<uint32_t>(_enterThreshold + offset, UINT16_MAX));
+    const uint16_t LOW_THRESHOLD = static_cast<uint16_t>(std::min<uint32_t>(_exitThreshold + offset, UINT16_MAX));
+
+    I2cBusLease lease(_busDevice, I2cPriority::NORMAL);
+    VCNL36828P_SET_PS_THDH(_sensorAddress, HIGH_THRESHOLD);
+    VCNL36828P_SET_PS_THDL(_sensorAddress, LOW_THRESHOLD);
+    VCNL36828P_SET_PS_PERS(_sensorAddress, VCNL36828P_PS_PERS_1); // Flag on the first sample past a threshold
+    if (has_interrupt_pin()) {
+        VCNL36828P_SET_PS_INT(_sensorAddress, VCNL36828P_PS_INT_EN);
+        VCNL36828P_GET_INT_FLAG(_sensorAddress); // Drop anything flagged before the thresholds were set
+    } else {
+        VCNL36828P_SET_PS_INT(_sensorAddress, VCNL36828P_PS_INT_DIS);
+    }
+}
+
+void SideTimeOfFlightSensor::update_proximity_state(uint16_t counts, uint64_t time_us) {
+    bool is_near = _isNear;
+    if (counts > _enterThreshold) {
+        is_near = true;
+    } else if (counts < _exitThreshold) {
+        is_near = false;
+    }
+    if (is_near == _isNear) {
+        return;
+    }
+    _isNear = is_near;
+    _nearChangedUs = time_us;
+}
+
+void SideTimeOfFlightSensor::request_interrupt_clear() {
+    if (!has_interrupt_pin() || !_interruptFlagRead.is_done() || digitalRead(_intPin) != LOW) {
+        return;
+    }
+    // The flag bits themselves aren't needed - enter/exit comes from the reading against the same thresholds
+    _busDevice.read_async(_interruptFlagRead, VCNL36828P_INT_FLAG, 2, I2cPriority::URGENT, PROXIMITY_READ_DEADLINE_MS);
+}
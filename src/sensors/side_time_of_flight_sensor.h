@@ -9,6 +9,7 @@
 #include "networking/serial_queue_manager.h"
 #include "sensor_data_buffer.h"
 #include "utils/config.h"
+#include "utils/i2c_bus_scheduler.h"
 #include "utils/preferences_manager.h"
 #include "utils/structs.h"
 
@@ -16,12 +17,17 @@ class SideTimeOfFlightSensor {
     friend class SideTofManager;
 
   private:
-    SideTimeOfFlightSensor() = default;
-    bool initialize(uint8_t TOF_ADDRESS);
+    SideTimeOfFlightSensor(uint8_t address, const char* name, int8_t int_pin)
+        : _sensorAddress(address), _intPin(int_pin), _busDevice(I2cBusId::BUS_1, address, name) {}
+    bool initialize();
     bool needs_initialization() const {
         return !_isInitialized;
     }
-    uint8_t _sensorAddress = 0; // Store the specific sensor address
+    const uint8_t _sensorAddress;
+    const int8_t _intPin; // -1: not wired
+    I2cDevice _busDevice;
+    I2cTransfer _proximityRead;
+    I2cTransfer _interruptFlagRead;
 
     // Initialization retry variables
     bool _isInitialized = false;
@@ -37,28 +43,52 @@ class SideTimeOfFlightSensor {
         vTaskDelay(pdMS_TO_TICKS(100));
     }
 
-    // Read proximity data from the sensor (with calibration applied)
-    uint16_t read_proximity_data() const {
-        const uint16_t RAW_READING = VCNL36828P_GET_PS_DATA(_sensorAddress);
-        return apply_calibration(RAW_READING);
-    }
-
     void basic_initialization_auto_mode();
 
     // Calibration methods
     void load_calibration_from_preferences();
     bool perform_calibration();
-    uint16_t capture_baseline_reading();
+    uint16_t capture_baseline_reading(uint16_t& spread);
     void apply_hardware_calibration(uint16_t baseline);
     uint16_t apply_calibration(uint16_t raw_reading) const; // <-- Added const
 
-    // For rate limiting reads
-    uint32_t _lastUpdateTime = 0;
-    static constexpr uint32_t DELAY_BETWEEN_READINGS = 1; // <-- Changed to static constexpr
+    static constexpr uint32_t PROXIMITY_READ_DEADLINE_MS = 20; // Drop a read the bus couldn't get to within the 50 ms cycle
+
+    // Queue a PS_DATA read on the bus scheduler without waiting for it, so the manager can have both sensors' reads
+    // in flight at once. Collect the result with take_proximity_data()
+    bool request_proximity_data();
+
+    // Waits (up to timeout_ms) for the queued read and returns the calibrated counts, or 0 if it failed or expired
+    uint16_t take_proximity_data(uint32_t timeout_ms);
+
+    // micros64() when the last read came off the bus; valid after take_proximity_data() returned non-zero
+    uint64_t get_proximity_time_us() const {
+        return _proximityRead.completedUs;
+    }
+
+    // Proximity events: near once the calibrated counts go above the enter threshold, clear again below the exit
+    // threshold. The thresholds are per robot - derived from the baseline noise when the sensor is calibrated and stored
+    // with the calibration in PreferencesManager (defaults on robots calibrated before that) - and are also programmed
+    // into PS_THDH/PS_THDL, so with INT wired the sensor itself signals each crossing
+    static constexpr uint16_t DEFAULT_ENTER_THRESHOLD = 50;
+    static constexpr uint16_t DEFAULT_EXIT_THRESHOLD = 35;
+    static constexpr uint16_t THRESHOLD_NOISE_MARGIN = 3; // Exit threshold, in multiples of the baseline spread
+    uint16_t _enterThreshold = DEFAULT_ENTER_THRESHOLD;
+    uint16_t _exitThreshold = DEFAULT_EXIT_THRESHOLD;
+    bool _isNear = false;
+    uint64_t _nearChangedUs = 0; // micros64() of the sample that last entered or exited
+
+    void load_thresholds_from_preferences();
+    void derive_thresholds(uint16_t spread);
+    void configure_threshold_interrupt();
 
-    // New buffer-based methods following the established pattern
-    void update_sensor_data(); // Read sensor and return data (don't store locally)
+    // Feed one valid reading; an enter or exit stamps _nearChangedUs with its time
+    void update_proximity_state(uint16_t counts, uint64_t time_us);
+
+    bool has_interrupt_pin() const {
+        return _intPin >= 0;
+    }
 
-    // For manager to get individual readings
-    uint16_t get_current_counts();
+    // INT stays low until INT_FLAG is read - queue that read if it's asserted
+    void request_interrupt_clear();
 };
@@ -1,5 +1,7 @@
 #include "side_tof_manager.h"
 
+#include <algorithm>
+
 bool SideTofManager::initialize() {
     bool left_success = false;
     bool right_success = false;
@@ -9,7 +11,7 @@ bool SideTofManager::initialize() {
         left_success = true; // Already initialized
     } else {
         SerialQueueManager::get_instance().queue_message("Initializing left side TOF...");
-        left_success = _leftSideTofSensor.initialize(LEFT_TOF_ADDRESS);
+        left_success = _leftSideTofSensor.initialize();
         if (left_success) {
             SerialQueueManager::get_instance().queue_message("Left side TOF initialized successfully");
         } else {
@@ -22,7 +24,7 @@ bool SideTofManager::initialize() {
         right_success = true; // Already initialized
     } else {
         SerialQueueManager::get_instance().queue_message("Initializing right side TOF...");
-        right_success = _rightSideTofSensor.initialize(RIGHT_TOF_ADDRESS);
+        right_success = _rightSideTofSensor.initialize();
         if (right_success) {
             SerialQueueManager::get_instance().queue_message("Right side TOF initialized successfully");
         } else {
@@ -33,6 +35,7 @@ bool SideTofManager::initialize() {
     _isInitialized = left_success && right_success;
 
     if (_isInitialized) {
+        attach_proximity_interrupts();
         SerialQueueManager::get_instance().queue_message("Side TOF Manager initialization complete");
     }
 
@@ -68,21 +71,41 @@ void SideTofManager::update_sensor_data() {
         return; // Skip if sensors not enabled
     }
 
-    // Update both sensors
-    _leftSideTofSensor.update_sensor_data();
-    _rightSideTofSensor.update_sensor_data();
-
-    // Get current readings from both sensors
-    const uint16_t LEFT_COUNTS = _leftSideTofSensor.get_current_counts();
-    const uint16_t RIGHT_COUNTS = _rightSideTofSensor.get_current_counts();
+    // Queue both reads before waiting on either, so they go out back to back in one bus task wake-up. A flagged INT is
+    // cleared in the same batch
+    _leftSideTofSensor.request_interrupt_clear();
+    _rightSideTofSensor.request_interrupt_clear();
+    const bool LEFT_QUEUED = _leftSideTofSensor.request_proximity_data();
+    const bool RIGHT_QUEUED = _rightSideTofSensor.request_proximity_data();
+
+    uint16_t left_counts = 0;
+    uint16_t right_counts = 0;
+    if (LEFT_QUEUED) {
+        left_counts = _leftSideTofSensor.take_proximity_data(READ_TIMEOUT_MS);
+    }
+    if (RIGHT_QUEUED) {
+        right_counts = _rightSideTofSensor.take_proximity_data(READ_TIMEOUT_MS);
+    }
 
     // Create SideTofData structure and write to buffer
     SideTofData side_tof_data;
-    side_tof_data.left_counts = LEFT_COUNTS;
-    side_tof_data.right_counts = RIGHT_COUNTS;
-    side_tof_data.left_valid = (LEFT_COUNTS != 0xFFFF && LEFT_COUNTS != 0);    // Basic validity check
-    side_tof_data.right_valid = (RIGHT_COUNTS != 0xFFFF && RIGHT_COUNTS != 0); // Basic validity check
-    side_tof_data.timestamp = millis();
+    side_tof_data.left_counts = left_counts;
+    side_tof_data.right_counts = right_counts;
+    side_tof_data.left_valid = (left_counts != 0xFFFF && left_counts != 0);    // Basic validity check
+    side_tof_data.right_valid = (right_counts != 0xFFFF && right_counts != 0); // Basic validity check
+    side_tof_data.timestampUs = std::max(_leftSideTofSensor.get_proximity_time_us(), _rightSideTofSensor.get_proximity_time_us());
+
+    // Enter/exit against each sensor's thresholds, from valid readings only
+    if (side_tof_data.left_valid) {
+        _leftSideTofSensor.update_proximity_state(left_counts, _leftSideTofSensor.get_proximity_time_us());
+    }
+    if (side_tof_data.right_valid) {
+        _rightSideTofSensor.update_proximity_state(right_counts, _rightSideTofSensor.get_proximity_time_us());
+    }
+    side_tof_data.left_near = _leftSideTofSensor._isNear;
+    side_tof_data.right_near = _rightSideTofSensor._isNear;
+    side_tof_data.left_changed_us = _leftSideTofSensor._nearChangedUs;
+    side_tof_data.right_changed_us = _rightSideTofSensor._nearChangedUs;
 
     // Write to buffer
     SensorDataBuffer::get_instance().update_side_tof_data(side_tof_data);
@@ -110,3 +133,42 @@ void SideTofManager::turn_off_side_tofs() {
     _isInitialized = false;
     SerialQueueManager::get_instance().queue_message("Side TOF sensors turned off");
 }
+
+void SideTofManager::attach_proximity_interrupts() {
+    if (_interruptAttached) {
+        return;
+    }
+    const int8_t PINS[] = {LEFT_SIDE_TOF_INT_PIN, RIGHT_SIDE_TOF_INT_PIN};
+    for (const int8_t PIN : PINS) {
+        if (PIN < 0) {
+            continue; // Not wired
+        }
+        pinMode(PIN, INPUT_PULLUP);
+        attachInterruptArg(digitalPinToInterrupt(PIN), on_proximity_interrupt, this, FALLING);
+        _interruptAttached = true;
+    }
+    if (_interruptAttached) {
+        SerialQueueManager::get_instance().queue_message("Side TOF using proximity interrupts");
+    }
+}
+
+void IRAM_ATTR SideTofManager::on_proximity_interrupt(void* arg) {
+    auto* instance = static_cast<SideTofManager*>(arg);
+    if (instance->_taskHandle == nullptr) {
+        return;
+    }
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(instance->_taskHandle, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+void SideTofManager::register_task(TaskHandle_t task_handle) {
+    _taskHandle = task_handle;
+}
+
+uint32_t SideTofManager::get_wait_ms() const {
+    if (_interruptAttached) {
+        return INTERRUPT_IDLE_WAIT_MS;
+    }
+    return POLL_WAIT_MS;
+}
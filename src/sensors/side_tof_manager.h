@@ -11,6 +11,11 @@ class SideTofManager : public Singleton<SideTofManager> {
     friend class SensorInitializer;
 
   private:
+    // Side TOFs
+    static constexpr uint8_t LEFT_TOF_ADDRESS = 0x51;
+    static constexpr uint8_t RIGHT_TOF_ADDRESS = 0x60;
+    static constexpr uint32_t READ_TIMEOUT_MS = 25; // Both reads are queued URGENT, so this only trips on a stuck bus
+
     SideTimeOfFlightSensor _leftSideTofSensor;
     SideTimeOfFlightSensor _rightSideTofSensor;
 
@@ -18,7 +23,9 @@ class SideTofManager : public Singleton<SideTofManager> {
     bool initialize();
 
     void turn_off_side_tofs();
-    SideTofManager() = default;
+    SideTofManager()
+        : _leftSideTofSensor(LEFT_TOF_ADDRESS, "SideTOF L", LEFT_SIDE_TOF_INT_PIN),
+          _rightSideTofSensor(RIGHT_TOF_ADDRESS, "SideTOF R", RIGHT_SIDE_TOF_INT_PIN) {}
 
     bool _isInitialized = false;
     bool _sensorsEnabled = false; // Track if sensors are actively enabled
@@ -30,7 +37,15 @@ class SideTofManager : public Singleton<SideTofManager> {
     void update_sensor_data(); // Single read, write to buffer
     bool should_be_polling();
 
-    // Side TOFs
-    const uint8_t LEFT_TOF_ADDRESS = 0x51;
-    const uint8_t RIGHT_TOF_ADDRESS = 0x60;
+    // Proximity interrupts: either sensor's INT wakes the side TOF task at once instead of at its next poll
+    void attach_proximity_interrupts();
+    static void on_proximity_interrupt(void* arg);
+    void register_task(TaskHandle_t task_handle);
+    uint32_t get_wait_ms() const;
+
+    static const uint16_t POLL_WAIT_MS = 50;            // 20 Hz without the interrupt
+    static const uint16_t INTERRUPT_IDLE_WAIT_MS = 100; // Counts refresh between events, and enable/disable still runs
+
+    TaskHandle_t _taskHandle = nullptr;
+    bool _interruptAttached = false;
 };
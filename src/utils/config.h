@@ -11,6 +11,7 @@ constexpr uint8_t MAX_LED_BRIGHTNESS = 75;
 constexpr uint8_t I2C_SDA_1 = 18;
 constexpr uint8_t I2C_SCL_1 = 8;
 constexpr uint32_t I2C_1_CLOCK_SPEED = 800 * 1000; // 800 kHz
+constexpr int I2C_1_PORT = 0;                      // ESP-IDF port behind Wire (large multizone TOF writes use it directly)
 constexpr uint8_t I2C_SDA_2 = 9;                   // Battery monitor, IMU
 constexpr uint8_t I2C_SCL_2 = 10;                  // Battery monitor, IMU
 constexpr uint32_t I2C_2_CLOCK_SPEED = 100 * 1000; // 100 kHz (works best for IMU)
@@ -40,6 +41,24 @@ constexpr uint8_t SCREEN_ADDRESS = 0x3C;
 constexpr uint8_t LEFT_BUTTON_PIN = 11;  // Left
 constexpr uint8_t RIGHT_BUTTON_PIN = 12; // Right
 
+// Multizone TOF data-ready line (VL53L7CX INT: open drain, pulled low when a frame is ready).
+// -1 when it isn't routed to a GPIO - the sensor task then polls for data over I2C instead
+constexpr int8_t MULTIZONE_TOF_INT_PIN = -1;
+
+// IMU data-ready line (BNO08x H_INTN: held low while reports are waiting to be read).
+// -1 when it isn't routed to a GPIO - the IMU task then polls every 5 ms instead
+constexpr int8_t IMU_INT_PIN = -1;
+
+// Side TOF proximity interrupt lines (VCNL36828P INT: open drain, pulled low on a threshold crossing until the
+// INT_FLAG register is read). -1 when not routed to a GPIO - the side TOF task then reads both sensors every 50 ms
+constexpr int8_t LEFT_SIDE_TOF_INT_PIN = -1;
+constexpr int8_t RIGHT_SIDE_TOF_INT_PIN = -1;
+
+// WebSockets
+// When true, commands and telemetry share one connection to /esp32-mux (one TLS session instead of two), with a
+// one-byte channel ID in front of every message. Requires a server that speaks the multiplexed protocol.
+constexpr bool USE_MULTIPLEXED_WEBSOCKET = false;
+
 // Assign Stack sizes for the two cores
 constexpr uint16_t MAX_PROGRAM_SIZE = 8192;
 constexpr uint16_t PWR_EN = 38;
@@ -78,6 +97,24 @@ inline const char* get_server_firmware_endpoint() {
     return "https://production-api.leverlabs.com/pip/firmware-update";
 }
 
+// Block-compressed image for the resumable streaming OTA (see streaming_ota.h)
+inline const char* get_server_compressed_firmware_endpoint() {
+    std::string env = get_environment();
+    if (env == "local") {
+        return "http://10.213.255.40:8080/pip/firmware-update/compressed";
+    }
+    return "https://production-api.leverlabs.com/pip/firmware-update/compressed";
+}
+
+// Delta against the running firmware, same container format (query: ?from=<running version>&to=<new version>)
+inline const char* get_server_delta_firmware_endpoint() {
+    std::string env = get_environment();
+    if (env == "local") {
+        return "http://10.213.255.40:8080/pip/firmware-update/delta";
+    }
+    return "https://production-api.leverlabs.com/pip/firmware-update/delta";
+}
+
 inline const char* get_ws_server_url() {
     std::string env = get_environment();
     if (env == "local") {
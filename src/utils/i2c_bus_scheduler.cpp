@@ -0,0 +1,305 @@
+#include "i2c_bus_scheduler.h"
+
+#include <cstring>
+
+#include "utils/utils.h"
+
+I2cDevice::I2cDevice(I2cBusId bus, uint8_t address, const char* name) : _bus(bus), _address(address), _name(name) {
+    _completed = xSemaphoreCreateCounting(I2cBusScheduler::QUEUE_DEPTH, 0);
+    I2cBusScheduler::get_instance().register_device(this);
+}
+
+bool I2cDevice::read_async(I2cTransfer& transfer, uint8_t reg, uint8_t length, I2cPriority priority, uint32_t deadline_ms) {
+    if (length == 0 || length > I2C_TRANSFER_MAX_LENGTH) {
+        return false;
+    }
+    transfer.reg = reg;
+    transfer.length = length;
+    return submit(transfer, I2cTransfer::Kind::READ, priority, deadline_ms);
+}
+
+bool I2cDevice::write_async(I2cTransfer& transfer, uint8_t reg, const uint8_t* data, uint8_t length, I2cPriority priority,
+                            uint32_t deadline_ms) {
+    if (length > I2C_TRANSFER_MAX_LENGTH) {
+        return false;
+    }
+    transfer.reg = reg;
+    transfer.length = length;
+    memcpy(transfer.data, data, length);
+    return submit(transfer, I2cTransfer::Kind::WRITE, priority, deadline_ms);
+}
+
+bool I2cDevice::submit(I2cTransfer& transfer, I2cTransfer::Kind kind, I2cPriority priority, uint32_t deadline_ms) {
+    transfer.kind = kind;
+    transfer.device = this;
+    transfer.priority = priority;
+    transfer.deadlineMs = 0;
+    if (deadline_ms != 0) {
+        transfer.deadlineMs = millis() + deadline_ms;
+        if (transfer.deadlineMs == 0) {
+            transfer.deadlineMs = 1; // 0 means no deadline
+        }
+    }
+    transfer.submittedUs = micros();
+    transfer.status.store(I2cStatus::PENDING);
+
+    I2cBusScheduler& scheduler = I2cBusScheduler::get_instance();
+    if (!scheduler.is_running(_bus)) {
+        // Boot-time path: nothing to schedule against yet, so run it here (Wire's own lock still serializes it)
+        scheduler.execute(_bus, transfer);
+        return true;
+    }
+
+    if (!scheduler.enqueue(transfer)) {
+        transfer.status.store(I2cStatus::QUEUE_FULL);
+        return false;
+    }
+    return true;
+}
+
+I2cStatus I2cDevice::wait(const I2cTransfer& transfer, uint32_t timeout_ms) {
+    const uint32_t START_TIME = millis();
+    while (!transfer.is_done()) {
+        const uint32_t ELAPSED = millis() - START_TIME;
+        if (ELAPSED >= timeout_ms) {
+            break;
+        }
+        uint32_t wait_ms = timeout_ms - ELAPSED;
+        if (wait_ms > WAIT_POLL_MS) {
+            wait_ms = WAIT_POLL_MS;
+        }
+        xSemaphoreTake(_completed, pdMS_TO_TICKS(wait_ms));
+    }
+    return transfer.status.load();
+}
+
+void I2cDevice::wait_for_completion(const I2cTransfer& transfer) {
+    while (!transfer.is_done()) {
+        xSemaphoreTake(_completed, pdMS_TO_TICKS(WAIT_POLL_MS));
+    }
+}
+
+I2cBusLease::I2cBusLease(I2cDevice& device, I2cPriority priority, uint32_t deadline_ms) : _device(device) {
+    if (!I2cBusScheduler::get_instance().is_running(device.get_bus())) {
+        _held = true;
+        return;
+    }
+    if (!device.submit(_transfer, I2cTransfer::Kind::LEASE, priority, deadline_ms)) {
+        return;
+    }
+
+    // The bus task only moves on once we release, so the grant (or expiry) always arrives
+    device.wait_for_completion(_transfer);
+    _held = _transfer.status.load() == I2cStatus::OK;
+    _scheduled = _held;
+}
+
+I2cBusLease::~I2cBusLease() {
+    if (!_scheduled) {
+        return;
+    }
+    I2cBusScheduler::get_instance().release_lease(_device.get_bus());
+}
+
+void I2cBusScheduler::register_device(I2cDevice* device) {
+    portENTER_CRITICAL(&_lock);
+    if (_deviceCount < MAX_DEVICES) {
+        _devices[_deviceCount++] = device;
+    }
+    portEXIT_CRITICAL(&_lock);
+}
+
+float I2cBusScheduler::take_utilization_percent(uint8_t index) {
+    if (index >= _deviceCount) {
+        return 0.0f;
+    }
+    const uint32_t NOW = micros();
+    const uint32_t BUSY_US = _devices[index]->get_stats().busyUs;
+    const uint32_t WINDOW_US = NOW - _lastUtilizationUs[index];
+    const uint32_t BUSY_DELTA_US = BUSY_US - _lastBusyUs[index];
+    _lastUtilizationUs[index] = NOW;
+    _lastBusyUs[index] = BUSY_US;
+    return WINDOW_US == 0 ? 0.0f : 100.0f * static_cast<float>(BUSY_DELTA_US) / static_cast<float>(WINDOW_US);
+}
+
+bool I2cBusScheduler::enqueue(I2cTransfer& transfer) {
+    Bus& bus = _buses[static_cast<uint8_t>(transfer.device->get_bus())];
+
+    portENTER_CRITICAL(&_lock);
+    const bool HAS_ROOM = bus.queued < QUEUE_DEPTH;
+    if (HAS_ROOM) {
+        transfer.sequence = _nextSequence++;
+        bus.queue[bus.queued++] = &transfer;
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (HAS_ROOM) {
+        xTaskNotifyGive(bus.task);
+    }
+    return HAS_ROOM;
+}
+
+void I2cBusScheduler::release_lease(I2cBusId bus) {
+    xSemaphoreGive(_buses[static_cast<uint8_t>(bus)].leaseReleased);
+}
+
+void I2cBusScheduler::run_bus(I2cBusId bus_id) {
+    Bus& bus = _buses[static_cast<uint8_t>(bus_id)];
+    bus.leaseReleased = xSemaphoreCreateBinary();
+    bus.task = xTaskGetCurrentTaskHandle(); // From here on, submissions queue instead of running inline
+
+    I2cTransfer* expired[QUEUE_DEPTH];
+
+    for (;;) {
+        uint8_t expired_count = 0;
+        I2cTransfer* next = take_next(bus, expired, expired_count);
+
+        for (uint8_t i = 0; i < expired_count; i++) {
+            complete(*expired[i], I2cStatus::EXPIRED);
+        }
+
+        if (next == nullptr) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        if (next->kind == I2cTransfer::Kind::LEASE) {
+            execute_lease(bus, *next);
+        } else {
+            execute(bus_id, *next);
+        }
+    }
+}
+
+I2cTransfer* I2cBusScheduler::take_next(Bus& bus, I2cTransfer** expired, uint8_t& expired_count) {
+    const uint32_t NOW = millis();
+    I2cTransfer* next = nullptr;
+
+    portENTER_CRITICAL(&_lock);
+
+    // Drop whatever has missed its deadline, compacting the queue as we go
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < bus.queued; i++) {
+        if (is_expired(*bus.queue[i], NOW)) {
+            expired[expired_count++] = bus.queue[i];
+        } else {
+            bus.queue[kept++] = bus.queue[i];
+        }
+    }
+    bus.queued = kept;
+
+    if (bus.queued > 0) {
+        uint8_t best = 0;
+        for (uint8_t i = 1; i < bus.queued; i++) {
+            if (runs_before(*bus.queue[i], *bus.queue[best])) {
+                best = i;
+            }
+        }
+        next = bus.queue[best];
+        bus.queue[best] = bus.queue[--bus.queued];
+    }
+
+    portEXIT_CRITICAL(&_lock);
+    return next;
+}
+
+void I2cBusScheduler::execute(I2cBusId bus, I2cTransfer& transfer) {
+    TwoWire& wire = get_wire(bus);
+    I2cDevice& device = *transfer.device;
+    const uint32_t START_US = micros();
+
+    bool success;
+    if (transfer.kind == I2cTransfer::Kind::WRITE) {
+        success = write_registers(wire, device.get_address(), transfer.reg, transfer.data, transfer.length);
+    } else {
+        success = read_registers(wire, device.get_address(), transfer.reg, transfer.data, transfer.length);
+    }
+
+    device._stats.transfers++;
+    device._stats.busyUs += micros() - START_US;
+
+    complete(transfer, success ? I2cStatus::OK : I2cStatus::BUS_ERROR);
+}
+
+void I2cBusScheduler::execute_lease(Bus& bus, I2cTransfer& transfer) {
+    I2cDevice& device = *transfer.device;
+    const uint32_t START_US = micros();
+
+    // Grant, then sit out until the holder is done. The transfer belongs to the lease and may be gone after this
+    complete(transfer, I2cStatus::OK);
+    xSemaphoreTake(bus.leaseReleased, portMAX_DELAY);
+
+    device._stats.transfers++;
+    device._stats.busyUs += micros() - START_US;
+}
+
+void I2cBusScheduler::complete(I2cTransfer& transfer, I2cStatus status) {
+    I2cDevice& device = *transfer.device;
+
+    if (status == I2cStatus::OK) {
+        const uint32_t LATENCY_US = micros() - transfer.submittedUs;
+        uint8_t bucket = 0;
+        while (bucket < I2C_LATENCY_BUCKETS - 1 && LATENCY_US >= I2C_LATENCY_BUCKET_LIMITS_US[bucket]) {
+            bucket++;
+        }
+        device._stats.latencyHistogram[bucket]++;
+    } else if (status == I2cStatus::EXPIRED) {
+        device._stats.expired++;
+    } else {
+        device._stats.errors++;
+    }
+
+    transfer.completedUs = micros64();
+
+    // Last touch: once the status is out of PENDING the owner may reuse or destroy the transfer
+    transfer.status.store(status);
+    xSemaphoreGive(device._completed);
+}
+
+TwoWire& I2cBusScheduler::get_wire(I2cBusId bus) {
+    if (bus == I2cBusId::BUS_2) {
+        return Wire1;
+    }
+    return Wire;
+}
+
+bool I2cBusScheduler::read_registers(TwoWire& wire, uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+    wire.beginTransmission(address);
+    wire.write(reg);
+    if (wire.endTransmission(false) != 0) {
+        return false;
+    }
+    if (wire.requestFrom(address, length) != length) {
+        return false;
+    }
+    for (uint8_t i = 0; i < length; i++) {
+        data[i] = static_cast<uint8_t>(wire.read());
+    }
+    return true;
+}
+
+bool I2cBusScheduler::write_registers(TwoWire& wire, uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+    wire.beginTransmission(address);
+    wire.write(reg);
+    if (length > 0) {
+        wire.write(data, length);
+    }
+    return wire.endTransmission() == 0;
+}
+
+bool I2cBusScheduler::runs_before(const I2cTransfer& a, const I2cTransfer& b) {
+    if (a.priority != b.priority) {
+        return a.priority > b.priority;
+    }
+    if (a.deadlineMs != b.deadlineMs) {
+        if (a.deadlineMs == 0 || b.deadlineMs == 0) {
+            return b.deadlineMs == 0; // Anything with a deadline goes ahead of open-ended work
+        }
+        return static_cast<int32_t>(a.deadlineMs - b.deadlineMs) < 0;
+    }
+    return static_cast<int32_t>(a.sequence - b.sequence) < 0;
+}
+
+bool I2cBusScheduler::is_expired(const I2cTransfer& transfer, uint32_t now_ms) {
+    return transfer.deadlineMs != 0 && static_cast<int32_t>(now_ms - transfer.deadlineMs) > 0;
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <Wire.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "utils/singleton.h"
+
+// Owns both I2C buses. Every bus access - a register transfer submitted by our own drivers, or a lease taken around a
+// third-party driver call - is queued here and run by that bus's task, highest priority first, then earliest deadline,
+// then in submission order. Transfers still queued when their deadline passes are dropped (EXPIRED) instead of
+// delaying everything behind them.
+enum class I2cBusId : uint8_t {
+    BUS_1, // Wire, 800 kHz: multizone TOF, side TOFs, color sensor, display
+    BUS_2, // Wire1, 100 kHz: IMU, battery monitor
+    COUNT
+};
+
+enum class I2cPriority : uint8_t { BACKGROUND = 0, NORMAL = 1, URGENT = 2, CRITICAL = 3 };
+
+enum class I2cStatus : uint8_t {
+    IDLE,       // Never submitted
+    PENDING,    // Queued or running
+    OK,         // Done (for a lease: the bus is granted)
+    BUS_ERROR,  // NACK or short read
+    EXPIRED,    // Deadline passed before the bus got to it
+    QUEUE_FULL, // Not queued at all
+};
+
+constexpr uint8_t I2C_TRANSFER_MAX_LENGTH = 8; // Inline data per transfer
+constexpr uint8_t I2C_LATENCY_BUCKETS = 5;     // Submit-to-complete: <250 us, <1 ms, <5 ms, <20 ms, longer
+constexpr uint32_t I2C_LATENCY_BUCKET_LIMITS_US[I2C_LATENCY_BUCKETS - 1] = {250, 1000, 5000, 20000};
+
+class I2cDevice;
+
+// One queued bus access. Owned by the caller, which keeps it alive and leaves it alone until is_done() - the bus
+// task writes data and status from its own context
+struct I2cTransfer {
+    enum class Kind : uint8_t { READ, WRITE, LEASE };
+
+    bool is_done() const {
+        return status.load() != I2cStatus::PENDING;
+    }
+
+    // Little-endian 16-bit register value (VCNL36828P, VEML3328)
+    uint16_t word() const {
+        return static_cast<uint16_t>(data[0] | (data[1] << 8));
+    }
+
+    std::atomic<I2cStatus> status{I2cStatus::IDLE};
+    uint8_t data[I2C_TRANSFER_MAX_LENGTH] = {};
+    uint8_t length = 0;
+    uint8_t reg = 0;
+
+    // Filled in by the scheduler
+    Kind kind = Kind::READ;
+    I2cDevice* device = nullptr;
+    I2cPriority priority = I2cPriority::NORMAL;
+    uint32_t deadlineMs = 0; // 0 = no deadline
+    uint32_t submittedUs = 0;
+    uint32_t sequence = 0;
+    uint64_t completedUs = 0; // micros64() when the transaction finished - the sample time for register reads
+};
+
+struct I2cDeviceStats {
+    uint32_t transfers = 0; // Bus transactions run for this device, leases included
+    uint32_t errors = 0;
+    uint32_t expired = 0;
+    uint32_t busyUs = 0; // Bus time held, for utilization (wraps after ~71 min; the logger uses deltas)
+    uint32_t latencyHistogram[I2C_LATENCY_BUCKETS] = {};
+};
+
+// A device on one of the buses. Our own drivers use it for non-blocking register transfers; third-party drivers that
+// talk to Wire directly take an I2cBusLease on it instead. Either way the bus time is accounted to this device.
+class I2cDevice {
+  public:
+    I2cDevice(I2cBusId bus, uint8_t address, const char* name);
+
+    // Queue a register read (register write, repeated start, length-byte read into transfer.data) or write. Returns
+    // false (status QUEUE_FULL) if the bus queue is full. deadline_ms is relative to now, 0 for none
+    bool read_async(I2cTransfer& transfer, uint8_t reg, uint8_t length, I2cPriority priority, uint32_t deadline_ms = 0);
+    bool write_async(I2cTransfer& transfer, uint8_t reg, const uint8_t* data, uint8_t length, I2cPriority priority,
+                     uint32_t deadline_ms = 0);
+
+    // Blocks the calling task until the transfer leaves PENDING or timeout_ms passes; returns the status either way
+    I2cStatus wait(const I2cTransfer& transfer, uint32_t timeout_ms);
+
+    I2cBusId get_bus() const {
+        return _bus;
+    }
+
+    uint8_t get_address() const {
+        return _address;
+    }
+
+    const char* get_name() const {
+        return _name;
+    }
+
+    const I2cDeviceStats& get_stats() const {
+        return _stats;
+    }
+
+  private:
+    friend class I2cBusScheduler;
+    friend class I2cBusLease;
+
+    bool submit(I2cTransfer& transfer, I2cTransfer::Kind kind, I2cPriority priority, uint32_t deadline_ms);
+    void wait_for_completion(const I2cTransfer& transfer);
+
+    static constexpr uint32_t WAIT_POLL_MS = 10; // Re-check bound, in case another waiter took this transfer's wake-up
+
+    const I2cBusId _bus;
+    const uint8_t _address;
+    const char* _name;
+    SemaphoreHandle_t _completed = nullptr; // Given once per finished transfer; waiters re-check the status
+    I2cDeviceStats _stats;                  // Written by the bus task only
+};
+
+// Exclusive use of a device's bus for the lifetime of the lease, granted in the same priority/deadline order as
+// transfers. Wrap each third-party driver call that reads or writes over Wire/Wire1 in one. The holder keeps its own
+// task priority, and queued transfers wait until it releases, so keep the work inside a lease short.
+// Never nest leases on the same bus - the inner one would wait forever for the outer one's release.
+class I2cBusLease {
+  public:
+    // deadline_ms: give up (is_held() false) if the bus isn't granted in time, 0 to wait as long as it takes
+    I2cBusLease(I2cDevice& device, I2cPriority priority, uint32_t deadline_ms = 0);
+    ~I2cBusLease();
+
+    I2cBusLease(const I2cBusLease&) = delete;
+    I2cBusLease& operator=(const I2cBusLease&) = delete;
+
+    bool is_held() const {
+        return _held;
+    }
+
+  private:
+    I2cDevice& _device;
+    I2cTransfer _transfer;
+    bool _held = false;
+    bool _scheduled = false; // Granted by the bus task (false before the scheduler starts: the lease is a no-op)
+};
+
+class I2cBusScheduler : public Singleton<I2cBusScheduler> {
+    friend class Singleton<I2cBusScheduler>;
+    friend class I2cDevice;
+    friend class I2cBusLease;
+    friend class TaskManager;
+
+  public:
+    static constexpr uint8_t MAX_DEVICES = 12;
+
+    uint8_t get_device_count() const {
+        return _deviceCount;
+    }
+
+    const I2cDevice* get_device(uint8_t index) const {
+        return index < _deviceCount ? _devices[index] : nullptr;
+    }
+
+    // Bus time held by the device since the previous call, as a percentage. Call from one task only (the logger)
+    float take_utilization_percent(uint8_t index);
+
+  private:
+    I2cBusScheduler() = default;
+
+    static constexpr uint8_t QUEUE_DEPTH = 16;
+
+    struct Bus {
+        TaskHandle_t task = nullptr;
+        SemaphoreHandle_t leaseReleased = nullptr;
+        I2cTransfer* queue[QUEUE_DEPTH] = {};
+        uint8_t queued = 0;
+    };
+
+    void register_device(I2cDevice* device);
+    bool enqueue(I2cTransfer& transfer);
+    void release_lease(I2cBusId bus);
+
+    // Bus task body (runs forever). Until it starts, transfers run inline in the caller and leases are no-ops, which
+    // keeps the boot-time initialization paths working
+    void run_bus(I2cBusId bus);
+    bool is_running(I2cBusId bus) const {
+        return _buses[static_cast<uint8_t>(bus)].task != nullptr;
+    }
+
+    // Pops the next transfer to run (nullptr when idle), and everything whose deadline has passed
+    I2cTransfer* take_next(Bus& bus, I2cTransfer** expired, uint8_t& expired_count);
+    void execute(I2cBusId bus, I2cTransfer& transfer);
+    void execute_lease(Bus& bus, I2cTransfer& transfer);
+    void complete(I2cTransfer& transfer, I2cStatus status);
+
+    static TwoWire& get_wire(I2cBusId bus);
+    static bool read_registers(TwoWire& wire, uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+    static bool write_registers(TwoWire& wire, uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length);
+    static bool runs_before(const I2cTransfer& a, const I2cTransfer& b);
+    static bool is_expired(const I2cTransfer& transfer, uint32_t now_ms);
+
+    Bus _buses[static_cast<uint8_t>(I2cBusId::COUNT)];
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t _nextSequence = 0;
+
+    I2cDevice* _devices[MAX_DEVICES] = {};
+    uint8_t _deviceCount = 0;
+    uint32_t _lastBusyUs[MAX_DEVICES] = {};
+    uint32_t _lastUtilizationUs[MAX_DEVICES] = {};
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Single-slot, latest-value-wins mailbox for idempotent commands.
+// A producer posts the newest value, overwriting any value the consumer has not taken yet (counted as superseded).
+// The consumer takes at most one value per poll, so a burst of N posts costs the consumer one apply, not N.
+// Guarded by a spinlock critical section, so it is safe across cores. T is copied with interrupts masked, so keep it
+// small plain data - use LatestFrameMailbox for anything frame sized.
+template <typename T> class LatestValueMailbox {
+  public:
+    void post(const T& value) {
+        portENTER_CRITICAL(&_lock);
+        if (_hasValue) {
+            _supersededCount++;
+        }
+        _value = value;
+        _hasValue = true;
+        _postedCount++;
+        portEXIT_CRITICAL(&_lock);
+    }
+
+    // Copies out the pending value, if any. Returns false when nothing new was posted since the last take
+    bool take(T& out) {
+        portENTER_CRITICAL(&_lock);
+        const bool HAD_VALUE = _hasValue;
+        if (HAD_VALUE) {
+            out = _value;
+            _hasValue = false;
+        }
+        portEXIT_CRITICAL(&_lock);
+        return HAD_VALUE;
+    }
+
+    // Drops a pending value without applying it (e.g. when the actuator is being stopped)
+    void discard() {
+        portENTER_CRITICAL(&_lock);
+        _hasValue = false;
+        portEXIT_CRITICAL(&_lock);
+    }
+
+    uint32_t get_posted_count() const {
+        return _postedCount;
+    }
+
+    uint32_t get_superseded_count() const {
+        return _supersededCount;
+    }
+
+  private:
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+    T _value{};
+    bool _hasValue = false;
+    volatile uint32_t _postedCount = 0;
+    volatile uint32_t _supersededCount = 0;
+};
+
+// Latest-value-wins mailbox for byte frames too large to copy with interrupts masked (display buffers).
+// Triple buffered: a producer copies into the spare buffer and the consumer reads its own buffer, both outside the
+// critical section, which only swaps buffer indexes. Producers take turns on a mutex for the copy; there is one consumer.
+template <size_t N> class LatestFrameMailbox {
+  public:
+    LatestFrameMailbox() {
+        _producerLock = xSemaphoreCreateMutexStatic(&_producerLockStorage);
+    }
+
+    void post(const uint8_t* frame) {
+        xSemaphoreTake(_producerLock, portMAX_DELAY);
+        memcpy(_buffers[_spareIndex], frame, N);
+
+        portENTER_CRITICAL(&_lock);
+        if (_hasValue) {
+            _supersededCount++;
+        }
+        const uint8_t PUBLISHED = _spareIndex;
+        _spareIndex = _pendingIndex;
+        _pendingIndex = PUBLISHED;
+        _hasValue = true;
+        _postedCount++;
+        portEXIT_CRITICAL(&_lock);
+
+        xSemaphoreGive(_producerLock);
+    }
+
+    // Returns the newest frame, or nullptr when nothing new was posted since the last take. The frame stays valid
+    // until the consumer's next take
+    const uint8_t* take() {
+        portENTER_CRITICAL(&_lock);
+        const bool HAD_VALUE = _hasValue;
+        if (HAD_VALUE) {
+            const uint8_t TAKEN = _pendingIndex;
+            _pendingIndex = _consumerIndex;
+            _consumerIndex = TAKEN;
+            _hasValue = false;
+        }
+        portEXIT_CRITICAL(&_lock);
+        return HAD_VALUE ? _buffers[_consumerIndex] : nullptr;
+    }
+
+    void discard() {
+        portENTER_CRITICAL(&_lock);
+        _hasValue = false;
+        portEXIT_CRITICAL(&_lock);
+    }
+
+    uint32_t get_posted_count() const {
+        return _postedCount;
+    }
+
+    uint32_t get_superseded_count() const {
+        return _supersededCount;
+    }
+
+  private:
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+    SemaphoreHandle_t _producerLock = nullptr;
+    StaticSemaphore_t _producerLockStorage{};
+    uint8_t _buffers[3][N] = {};
+    uint8_t _spareIndex = 0;    // Written by the producer holding _producerLock
+    uint8_t _pendingIndex = 1;  // Newest posted frame while _hasValue
+    uint8_t _consumerIndex = 2; // Last frame handed to the consumer
+    bool _hasValue = false;
+    volatile uint32_t _postedCount = 0;
+    volatile uint32_t _supersededCount = 0;
+};
@@ -167,6 +167,87 @@ std::vector<WiFiCredentials> PreferencesManager::get_all_stored_wifi_networks()
     return _cache.wifi_networks;
 }
 
+// Fast reconnect methods
+String PreferencesManager::fast_connect_key(const String& ssid) {
+    // SSIDs can be up to 32 bytes but NVS keys are limited to 15 characters, so key the record by a hash (FNV-1a)
+    uint32_t hash = 2166136261UL;
+    for (size_t i = 0; i < ssid.length(); i++) {
+        hash ^= static_cast<uint8_t>(ssid[i]);
+        hash *= 16777619UL;
+    }
+    return String("fc_") + String(hash, HEX);
+}
+
+void PreferencesManager::store_wifi_fast_connect(const String& ssid, const WiFiFastConnectRecord& record) {
+    if (!begin_namespace(NS_WIFI_FAST)) {
+        return;
+    }
+
+    const String KEY = fast_connect_key(ssid);
+
+    // Skip identical records so reconnecting to the same AP does not wear the flash
+    WiFiFastConnectRecord existing{};
+    const bool UNCHANGED = _preferences.getBytes(KEY.c_str(), &existing, sizeof(existing)) == sizeof(existing) &&
+                           memcmp(&existing, &record, sizeof(record)) == 0;
+    if (!UNCHANGED) {
+        _preferences.putBytes(KEY.c_str(), &record, sizeof(record));
+    }
+    if (_preferences.getString(KEY_LAST_SSID, "") != ssid) {
+        _preferences.putString(KEY_LAST_SSID, ssid);
+    }
+}
+
+bool PreferencesManager::get_wifi_fast_connect(const String& ssid, WiFiFastConnectRecord& record) {
+    if (!begin_namespace(NS_WIFI_FAST)) {
+        return false;
+    }
+
+    const String KEY = fast_connect_key(ssid);
+    return _preferences.getBytes(KEY.c_str(), &record, sizeof(record)) == sizeof(record) && record.channel != 0;
+}
+
+void PreferencesManager::clear_wifi_fast_connect(const String& ssid) {
+    if (!begin_namespace(NS_WIFI_FAST)) {
+        return;
+    }
+
+    const String KEY = fast_connect_key(ssid);
+    if (_preferences.isKey(KEY.c_str())) {
+        _preferences.remove(KEY.c_str());
+    }
+}
+
+String PreferencesManager::get_last_connected_ssid() {
+    if (!begin_namespace(NS_WIFI_FAST)) {
+        return "";
+    }
+    return _preferences.getString(KEY_LAST_SSID, "");
+}
+
+// Streaming OTA methods
+void PreferencesManager::store_ota_progress(const OtaProgressRecord& record) {
+    if (!begin_namespace(NS_OTA)) {
+        return;
+    }
+    _preferences.putBytes(KEY_OTA_PROGRESS, &record, sizeof(record));
+}
+
+bool PreferencesManager::get_ota_progress(OtaProgressRecord& record) {
+    if (!begin_namespace(NS_OTA)) {
+        return false;
+    }
+    return _preferences.getBytes(KEY_OTA_PROGRESS, &record, sizeof(record)) == sizeof(record);
+}
+
+void PreferencesManager::clear_ota_progress() {
+    if (!begin_namespace(NS_OTA)) {
+        return;
+    }
+    if (_preferences.isKey(KEY_OTA_PROGRESS)) {
+        _preferences.remove(KEY_OTA_PROGRESS);
+    }
+}
+
 // Side TOF calibration methods
 bool PreferencesManager::has_side_tof_calibration(uint8_t sensor_address) {
     if (!begin_namespace(NS_SIDE_TOF)) {
@@ -210,6 +291,34 @@ bool PreferencesManager::get_side_tof_use_hardware_calibration(uint8_t sensor_ad
     return _preferences.getBool(HW_CALIB_KEY.c_str(), false);
 }
 
+void PreferencesManager::store_side_tof_thresholds(uint8_t sensor_address, uint16_t enter_threshold, uint16_t exit_threshold) {
+    if (!begin_namespace(NS_SIDE_TOF)) {
+        return;
+    }
+
+    const String ENTER_KEY = String("enter_") + String(sensor_address, HEX);
+    const String EXIT_KEY = String("exit_") + String(sensor_address, HEX);
+
+    _preferences.putUShort(ENTER_KEY.c_str(), enter_threshold);
+    _preferences.putUShort(EXIT_KEY.c_str(), exit_threshold);
+}
+
+bool PreferencesManager::get_side_tof_thresholds(uint8_t sensor_address, uint16_t& enter_threshold, uint16_t& exit_threshold) {
+    if (!begin_namespace(NS_SIDE_TOF)) {
+        return false;
+    }
+
+    const String ENTER_KEY = String("enter_") + String(sensor_address, HEX);
+    const String EXIT_KEY = String("exit_") + String(sensor_address, HEX);
+
+    if (!_preferences.isKey(ENTER_KEY.c_str()) || !_preferences.isKey(EXIT_KEY.c_str())) {
+        return false;
+    }
+    enter_threshold = _preferences.getUShort(ENTER_KEY.c_str(), 0);
+    exit_threshold = _preferences.getUShort(EXIT_KEY.c_str(), 0);
+    return true;
+}
+
 bool PreferencesManager::forget_wifi_network(const String& target_ssid) {
     if (!begin_namespace(NS_WIFI)) {
         return false;
@@ -256,5 +365,8 @@ bool PreferencesManager::forget_wifi_network(const String& target_ssid) {
     _cache.wifi_networks.clear();
     _cache.wifi_count = 0;
 
+    // A forgotten network must not be rejoined through the fast reconnect path
+    clear_wifi_fast_connect(target_ssid);
+
     return true;
 }
@@ -42,11 +42,24 @@ class PreferencesManager : public Singleton<PreferencesManager> {
     std::vector<WiFiCredentials> get_all_stored_wifi_networks();
     bool has_stored_wifi_networks(); // Add this new method
 
+    // Cached BSSID/channel per SSID for fast reconnects
+    void store_wifi_fast_connect(const String& ssid, const WiFiFastConnectRecord& record);
+    bool get_wifi_fast_connect(const String& ssid, WiFiFastConnectRecord& record);
+    void clear_wifi_fast_connect(const String& ssid);
+    String get_last_connected_ssid();
+
+    // Streaming OTA resume point
+    void store_ota_progress(const OtaProgressRecord& record);
+    bool get_ota_progress(OtaProgressRecord& record);
+    void clear_ota_progress();
+
     // Side TOF calibration methods
     bool has_side_tof_calibration(uint8_t sensor_address);
     void store_side_tof_calibration(uint8_t sensor_address, uint16_t baseline, bool use_hardware_calibration);
     uint16_t get_side_tof_baseline(uint8_t sensor_address);
     bool get_side_tof_use_hardware_calibration(uint8_t sensor_address);
+    void store_side_tof_thresholds(uint8_t sensor_address, uint16_t enter_threshold, uint16_t exit_threshold);
+    bool get_side_tof_thresholds(uint8_t sensor_address, uint16_t& enter_threshold, uint16_t& exit_threshold);
     bool forget_wifi_network(const String& target_ssid);
 
   private:
@@ -70,14 +83,20 @@ class PreferencesManager : public Singleton<PreferencesManager> {
     void load_firmware_version_cache();
     void load_wifi_data_cache();
 
+    static String fast_connect_key(const String& ssid);
+
     // Namespace constants (akin to folders)
     static constexpr const char* NS_PIP_ID = "pip_id";
     static constexpr const char* NS_FIRMWARE = "firmware";
     static constexpr const char* NS_WIFI = "wifi";
     static constexpr const char* NS_SIDE_TOF = "side_tof";
+    static constexpr const char* NS_WIFI_FAST = "wifi_fast";
+    static constexpr const char* NS_OTA = "ota";
 
     // Key constants (akin to files in those folders)
     static constexpr const char* KEY_PIP_ID = "id";
     static constexpr const char* KEY_FW_VERSION = "fw_version";
     static constexpr const char* WIFI_COUNT = "wifi_count";
+    static constexpr const char* KEY_LAST_SSID = "last_ssid";
+    static constexpr const char* KEY_OTA_PROGRESS = "progress";
 };
@@ -17,10 +17,8 @@ void imu_logger() {
     EulerAngles euler_angles = SensorDataBuffer::get_instance().get_latest_euler_angles();
     float frequency = SensorDataBuffer::get_instance().get_imu_frequency();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "IMU Frequency: %.1f Hz, Data Valid: %s, Yaw: %.1f, Pitch: %.1f, Roll: %.1f", frequency,
-             euler_angles.isValid ? "YES" : "NO", euler_angles.yaw, euler_angles.pitch, euler_angles.roll);
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::IMU_FREQUENCY, frequency, euler_angles.isValid ? "YES" : "NO", euler_angles.yaw,
+                                           euler_angles.pitch, euler_angles.roll);
 
     last_imu_print_time = millis();
 }
@@ -35,9 +33,7 @@ void side_tofs_logger() {
     SideTofData tof_counts = SensorDataBuffer::get_instance().get_latest_side_tof_data();
     // DisplayScreen::get_instance().showDistanceSensors(tofCounts);
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "Left TOF: %u counts              || Right TOF: %u counts", tof_counts.left_counts, tof_counts.right_counts);
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::SIDE_TOF_COUNTS, tof_counts.left_counts, tof_counts.right_counts);
     last_print_time = millis();
 }
 
@@ -49,11 +45,11 @@ void setup_button_loggers() {
         [](Button2& btn) { SerialQueueManager::get_instance().queue_message("Right Button clicked!"); });
 
     Buttons::get_instance().set_left_button_long_press_handler([](Button2& btn) {
-        SerialQueueManager::get_instance().queue_message("Left Button long pressed for " + String(btn.wasPressedFor()) + " ms");
+        SerialQueueManager::get_instance().log(LogFormat::BUTTON_LONG_PRESS_LEFT, btn.wasPressedFor());
     });
 
     Buttons::get_instance().set_right_button_long_press_handler([](Button2& btn) {
-        SerialQueueManager::get_instance().queue_message("Right Button long pressed for " + String(btn.wasPressedFor()) + " ms");
+        SerialQueueManager::get_instance().log(LogFormat::BUTTON_LONG_PRESS_RIGHT, btn.wasPressedFor());
     });
 }
 
@@ -68,10 +64,8 @@ void multizone_tof_logger() {
     float frequency = SensorDataBuffer::get_instance().get_multizone_tof_frequency();
     TofData tof_data = SensorDataBuffer::get_instance().get_latest_tof_data();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "Multizone ToF Frequency: %.1f Hz, Data Valid: %s, Object Detected: %s", frequency,
-             tof_data.is_valid ? "YES" : "NO", tof_data.is_object_detected ? "Object Detected" : "Object not detected");
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::MULTIZONE_TOF_FREQUENCY, frequency, tof_data.is_valid ? "YES" : "NO",
+                                           tof_data.is_object_detected ? "Object Detected" : "Object not detected");
 
     last_print_time = millis();
 }
@@ -87,9 +81,7 @@ void side_tof_logger() {
     float frequency = SensorDataBuffer::get_instance().get_side_tof_frequency();
     SideTofData tof_data = SensorDataBuffer::get_instance().get_latest_side_tof_data();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "Side ToF Frequency: %.1f Hz, Left: %u, Right: %u", frequency, tof_data.left_counts, tof_data.right_counts);
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::SIDE_TOF_FREQUENCY, frequency, tof_data.left_counts, tof_data.right_counts);
 
     last_print_time = millis();
 }
@@ -105,10 +97,8 @@ void color_sensor_logger() {
     float frequency = SensorDataBuffer::get_instance().get_color_sensor_frequency();
     ColorData color_data = SensorDataBuffer::get_instance().get_latest_color_data();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "Color Sensor Frequency: %.1f Hz, RGB: (%u,%u,%u)", frequency, color_data.red_value, color_data.green_value,
-             color_data.blue_value);
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::COLOR_SENSOR_FREQUENCY, frequency, color_data.red_value, color_data.green_value,
+                                           color_data.blue_value);
 
     last_print_time = millis();
 }
@@ -123,9 +113,7 @@ void log_motor_rpm() {
 
     auto rpms = SensorDataBuffer::get_instance().get_latest_wheel_rpms();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "Motor RPM - Left: %.2f || Right: %.2f", rpms.leftWheelRPM, rpms.rightWheelRPM);
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::MOTOR_RPM, rpms.leftWheelRPM, rpms.rightWheelRPM);
 
     last_print_time = millis();
 }
@@ -140,13 +128,86 @@ void display_performance_logger() {
 
     DisplayScreen& display = DisplayScreen::get_instance();
 
-    char buffer[128];
-    snprintf(buffer, sizeof(buffer), "DISPLAY: %.2f Hz actual I2C (Generated: %lu, Updates: %lu, Skipped: %lu)",
-             DisplayScreen::get_display_update_rate(), display.get_content_generation_count(), display.get_display_update_count(),
-             display.get_skipped_update_count());
-    SerialQueueManager::get_instance().queue_message(buffer);
+    SerialQueueManager::get_instance().log(LogFormat::DISPLAY_PERFORMANCE, DisplayScreen::get_display_update_rate(),
+                                           display.get_content_generation_count(), display.get_display_update_count(),
+                                           display.get_skipped_update_count());
 
     // Reset performance counters for next measurement period
     display.reset_performance_counters();
     last_print_time = millis();
 }
+
+void actuator_mailbox_logger() {
+    static uint32_t last_print_time = 0;
+    static uint32_t last_superseded_total = 0;
+    const uint32_t PRINT_INTERVAL = 1000; // Print at most every 1 second, and only when something was superseded
+
+    if (millis() - last_print_time < PRINT_INTERVAL) {
+        return;
+    }
+    last_print_time = millis();
+
+    const ActuatorMailbox& mailbox = ActuatorMailbox::get_instance();
+    uint32_t superseded_total = 0;
+    for (uint8_t i = 0; i < static_cast<uint8_t>(ActuatorChannel::COUNT); i++) {
+        superseded_total += mailbox.get_superseded_count(static_cast<ActuatorChannel>(i));
+    }
+    if (superseded_total == last_superseded_total) {
+        return;
+    }
+    last_superseded_total = superseded_total;
+
+    // Totals since boot; compare with get_posted_count() to get the coalescing ratio
+    SerialQueueManager::get_instance().log(LogFormat::ACTUATOR_SUPERSEDED, mailbox.get_superseded_count(ActuatorChannel::MOTOR_PWM),
+                                           mailbox.get_superseded_count(ActuatorChannel::LED_COLORS),
+                                           mailbox.get_superseded_count(ActuatorChannel::HEADLIGHTS),
+                                           mailbox.get_superseded_count(ActuatorChannel::DISPLAY_BUFFER));
+}
+
+void websocket_link_logger() {
+    static uint32_t last_print_time = 0;
+    static uint32_t last_shed = 0;
+    static uint8_t last_downsample = 1;
+    const uint32_t PRINT_INTERVAL = 5000; // Print every 5 seconds while telemetry is being shed or downsampled
+
+    if (millis() - last_print_time < PRINT_INTERVAL || !SensorWebSocketManager::get_instance().is_ws_connected()) {
+        return;
+    }
+    last_print_time = millis();
+
+    const WsLinkStats STATS = SensorWebSocketManager::get_instance().get_link_stats();
+    if (STATS.telemetryShed == last_shed && STATS.telemetryDownsample == 1 && last_downsample == 1) {
+        return;
+    }
+    last_shed = STATS.telemetryShed;
+    last_downsample = STATS.telemetryDownsample;
+
+    SerialQueueManager::get_instance().log(LogFormat::WS_LINK_STATS, CommandWebSocketManager::get_instance().get_rtt_ms(),
+                                           STATS.avgSendMicros, STATS.throughputBytesSec, STATS.telemetryShed,
+                                           static_cast<unsigned>(STATS.telemetryDownsample));
+}
+
+void i2c_bus_logger() {
+    static uint32_t last_print_time = 0;
+    const uint32_t PRINT_INTERVAL = 5000; // Print every 5 seconds
+
+    if (millis() - last_print_time < PRINT_INTERVAL) {
+        return;
+    }
+    last_print_time = millis();
+
+    // Utilization is over the last interval; counts and the latency histogram are totals since boot
+    I2cBusScheduler& scheduler = I2cBusScheduler::get_instance();
+    for (uint8_t i = 0; i < scheduler.get_device_count(); i++) {
+        const I2cDevice* device = scheduler.get_device(i);
+        const I2cDeviceStats& stats = device->get_stats();
+        const uint32_t* histogram = stats.latencyHistogram;
+
+        char message[192];
+        snprintf(message, sizeof(message),
+                 "I2C%u %-12s %5.1f%% busy, %lu xfers, %lu err, %lu expired | latency <250us/1ms/5ms/20ms/more: %lu/%lu/%lu/%lu/%lu",
+                 static_cast<unsigned>(device->get_bus()) + 1, device->get_name(), scheduler.take_utilization_percent(i), stats.transfers,
+                 stats.errors, stats.expired, histogram[0], histogram[1], histogram[2], histogram[3], histogram[4]);
+        SerialQueueManager::get_instance().queue_message(message);
+    }
+}
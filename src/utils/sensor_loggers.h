@@ -1,12 +1,16 @@
 #pragma once
+#include "actuators/actuator_mailbox.h"
 #include "actuators/buttons.h"
 #include "actuators/display_screen.h"
+#include "networking/command_websocket_manager.h"
+#include "networking/sensor_websocket_manager.h"
 #include "networking/serial_queue_manager.h"
 #include "sensors/imu.h"
 #include "sensors/multizone_tof_sensor.h"
 #include "sensors/sensor_data_buffer.h"
 #include "sensors/side_tof_manager.h"
 #include "utils.h"
+#include "utils/i2c_bus_scheduler.h"
 
 void multizone_tof_logger();
 void imu_logger();
@@ -17,3 +21,6 @@ void ir_sensor_logger();
 void setup_button_loggers();
 void log_motor_rpm();
 void display_performance_logger();
+void actuator_mailbox_logger();
+void websocket_link_logger();
+void i2c_bus_logger();
@@ -6,6 +6,22 @@ struct WiFiCredentials {
     String password;
 };
 
+// Last successful association with one SSID. Lets the next connect skip the scan.
+// Stored as a Preferences blob, so it must stay plain data
+struct WiFiFastConnectRecord {
+    uint8_t bssid[6];
+    uint8_t channel;
+};
+
+// Resume point of an interrupted streaming OTA. Stored as a Preferences blob, so it must stay plain data
+struct OtaProgressRecord {
+    uint16_t version;
+    uint8_t imageSha256[32];
+    uint32_t partitionAddress;
+    uint32_t blockSize; // Delta and full images of one version may be blocked differently
+    uint32_t blocksCommitted;
+};
+
 struct WiFiNetworkInfo {
     String ssid;
     int32_t rssi;
@@ -19,9 +35,12 @@ struct EnabledReports {
     bool magneticField = false;
 };
 
+// IMU samples carry the BNO08x's own SH-2 timestamp: when the sensor took the sample, not when the host got around to
+// reading it. SH-2 extends the host clock to 64 bits, so it lines up with micros64()
 struct QuaternionData {
     float qX{}, qY{}, qZ{}, qW{};
     bool isValid = false;
+    uint64_t timestampUs = 0;
 };
 
 struct EulerAngles {
@@ -29,21 +48,25 @@ struct EulerAngles {
     float pitch{};
     float roll{};
     bool isValid = false;
+    uint64_t timestampUs = 0; // Of the quaternion it was derived from
 };
 
 struct AccelerometerData {
     float aX{}, aY{}, aZ{};
     bool isValid = false;
+    uint64_t timestampUs = 0;
 };
 
 struct GyroscopeData {
     float gX{}, gY{}, gZ{};
     bool isValid = false;
+    uint64_t timestampUs = 0;
 };
 
 struct MagnetometerData {
     float mX{}, mY{}, mZ{};
     bool isValid = false;
+    uint64_t timestampUs = 0;
 };
 
 struct WheelRPMs {
@@ -103,7 +126,7 @@ struct BatteryState {
 };
 
 // Can go to both Serial and Server
-enum class ToCommonMessage : uint8_t { SENSOR_DATA, SENSOR_DATA_MZ, DINO_SCORE, PIP_TURNING_OFF, HEARTBEAT };
+enum class ToCommonMessage : uint8_t { SENSOR_DATA, SENSOR_DATA_MZ, DINO_SCORE, PIP_TURNING_OFF, HEARTBEAT, FRAME_ACK };
 
 enum class ToServerMessage : uint8_t {
     DEVICE_INITIAL_DATA,
@@ -122,5 +145,6 @@ enum class ToSerialMessage : uint8_t {
     PROGRAM_PAUSED_USB,
     BATTERY_MONITOR_DATA_ITEM,
     BATTERY_MONITOR_DATA_COMPLETE,
-    WIFI_DELETED_NETWORK
+    WIFI_DELETED_NETWORK,
+    SCAN_DIFF
 };
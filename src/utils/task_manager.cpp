@@ -2,6 +2,7 @@
 
 #include "career_quest/career_quest_triggers.h"
 #include "sensors/sensor_initializer.h"
+#include "utils/i2c_bus_scheduler.h"
 
 TaskHandle_t TaskManager::button_task_handle = nullptr;
 TaskHandle_t TaskManager::serial_input_task_handle = nullptr;
@@ -17,6 +18,7 @@ TaskHandle_t TaskManager::multizone_tof_sensor_task_handle = nullptr;
 TaskHandle_t TaskManager::side_tof_sensor_task_handle = nullptr;
 TaskHandle_t TaskManager::color_sensor_task_handle = nullptr;
 TaskHandle_t TaskManager::sensor_logger_task_handle = nullptr;
+TaskHandle_t TaskManager::multizone_tof_init_task_handle = nullptr;
 TaskHandle_t TaskManager::display_task_handle = nullptr;
 TaskHandle_t TaskManager::network_management_task_handle = nullptr;
 TaskHandle_t TaskManager::send_sensor_data_task_handle = nullptr;
@@ -32,6 +34,8 @@ TaskHandle_t TaskManager::display_init_task_handle = nullptr;
 TaskHandle_t TaskManager::sensor_web_socket_task_handle = nullptr;
 TaskHandle_t TaskManager::command_web_socket_task_handle = nullptr;
 TaskHandle_t TaskManager::heartbeat_task_handle = nullptr;
+TaskHandle_t TaskManager::i2c_bus_1_task_handle = nullptr;
+TaskHandle_t TaskManager::i2c_bus_2_task_handle = nullptr;
 
 void TaskManager::button_task(void* parameter) {
     (void)parameter; // Mark as intentionally unused
@@ -47,13 +51,14 @@ void TaskManager::serial_input_task(void* parameter) {
     (void)parameter; // Mark as intentionally unused
     for (;;) {
         SerialManager::get_instance().poll_serial();
-        vTaskDelay(pdMS_TO_TICKS(2));
+        SerialManager::get_instance().wait_for_serial_data(); // Sleeps until USB-CDC reports RX data
     }
 }
 
 void TaskManager::led_task(void* parameter) {
     (void)parameter; // Mark as intentionally unused
     for (;;) {
+        ActuatorMailbox::get_instance().apply_pending_led_commands();
         led_animations.update();
         vTaskDelay(pdMS_TO_TICKS(5));
     }
@@ -80,6 +85,7 @@ void TaskManager::display_task(void* parameter) {
     SerialQueueManager::get_instance().queue_message("Display task started");
 
     for (;;) {
+        ActuatorMailbox::get_instance().apply_pending_display_buffer();
         DisplayScreen::get_instance().update();
         vTaskDelay(pdMS_TO_TICKS(40)); // 25Hz update rate, smooth for animations
     }
@@ -95,13 +101,14 @@ void TaskManager::imu_sensor_task(void* parameter) {
         vTaskDelay(pdMS_TO_TICKS(50)); // Check every 50ms
     }
     SerialQueueManager::get_instance().queue_message("IMU centralized initialization complete.");
+    ImuSensor::get_instance().register_task(xTaskGetCurrentTaskHandle());
 
-    // Main polling loop
+    // Main loop: woken by BNO08x INT when it's wired, otherwise polls at 200Hz. Each pass drains every pending report
     for (;;) {
         if (ImuSensor::get_instance().should_be_polling()) {
             ImuSensor::get_instance().update_sensor_data();
         }
-        vTaskDelay(pdMS_TO_TICKS(5)); // 200Hz - critical for motion control
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ImuSensor::get_instance().get_wait_ms()));
     }
 }
 
@@ -129,16 +136,26 @@ void TaskManager::multizone_tof_sensor_task(void* parameter) {
         vTaskDelay(pdMS_TO_TICKS(50)); // Check every 50ms
     }
     SerialQueueManager::get_instance().queue_message("Multizone TOF centralized initialization complete.");
+    MultizoneTofSensor::get_instance().register_task(xTaskGetCurrentTaskHandle());
 
-    // Main polling loop
+    // Main loop: woken by the data-ready interrupt when INT is wired, otherwise polls frequently (throttling handled
+    // in update_sensor_data())
     for (;;) {
         if (MultizoneTofSensor::get_instance().should_be_polling()) {
             MultizoneTofSensor::get_instance().update_sensor_data();
         }
-        vTaskDelay(pdMS_TO_TICKS(5)); // Allow frequent polling, throttling handled in update_sensor_data()
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MultizoneTofSensor::get_instance().get_wait_ms()));
     }
 }
 
+void TaskManager::multizone_tof_init_task(void* parameter) {
+    // The initializer is still being constructed when this starts, so it comes in as a parameter rather than through get_instance()
+    static_cast<SensorInitializer*>(parameter)->initialize_multizone_tof();
+
+    multizone_tof_init_task_handle = nullptr;
+    vTaskDelete(nullptr);
+}
+
 void TaskManager::side_tof_sensor_task(void* parameter) {
     (void)parameter; // Mark as intentionally unused
     SerialQueueManager::get_instance().queue_message("Side TOF sensor task started");
@@ -149,13 +166,14 @@ void TaskManager::side_tof_sensor_task(void* parameter) {
         vTaskDelay(pdMS_TO_TICKS(100));
     }
     SerialQueueManager::get_instance().queue_message("Side TOF sensors initialized successfully");
+    SideTofManager::get_instance().register_task(xTaskGetCurrentTaskHandle());
 
-    // Main polling loop
+    // Main loop: woken by a proximity interrupt when INT is wired, otherwise polls at 20 Hz
     for (;;) {
         if (SideTofManager::get_instance().should_be_polling()) {
             SideTofManager::get_instance().update_sensor_data();
         }
-        vTaskDelay(pdMS_TO_TICKS(50)); // 20Hz target rate
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SideTofManager::get_instance().get_wait_ms()));
     }
 }
 
@@ -192,6 +210,9 @@ void TaskManager::sensor_logger_task(void* parameter) {
         // irSensorLogger();
         // log_motor_rpm();  // Keep this commented for now since it's not frequency-based
         // display_performance_logger();
+        // i2c_bus_logger();
+        // actuator_mailbox_logger(); // Silent unless high-rate commands were coalesced
+        // websocket_link_logger();   // Silent unless telemetry is being shed or downsampled
 
         // Small delay between logger cycles - loggers have their own internal timing
         vTaskDelay(pdMS_TO_TICKS(10)); // 100Hz - fast polling, loggers handle their own rate limiting
@@ -244,6 +265,11 @@ void TaskManager::send_sensor_data_task(void* parameter) {
     }
 }
 
+void TaskManager::i2c_bus_task(void* parameter) {
+    const I2cBusId BUS = static_cast<I2cBusId>(reinterpret_cast<uintptr_t>(parameter));
+    I2cBusScheduler::get_instance().run_bus(BUS); // Never returns
+}
+
 void TaskManager::serial_queue_task(void* parameter) {
     // Cast back to SerialQueueManager and call its task method
     auto* instance = static_cast<SerialQueueManager*>(parameter);
@@ -273,11 +299,13 @@ void TaskManager::speaker_task(void* parameter) {
 void TaskManager::motor_task(void* parameter) {
     (void)parameter; // Mark as intentionally unused
     SerialQueueManager::get_instance().queue_message("Motor task started");
+    ActuatorMailbox::get_instance().register_motor_task(xTaskGetCurrentTaskHandle());
 
     for (;;) {
+        ActuatorMailbox::get_instance().apply_pending_motor_command();
         motor_driver.update();
         motor_driver.process_pending_commands();
-        vTaskDelay(pdMS_TO_TICKS(2)); // Fast motor update - 2ms
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(2)); // Fast motor update - 2ms, or sooner when a new PWM command is posted
     }
 }
 
@@ -422,6 +450,11 @@ bool TaskManager::create_multizone_tof_sensor_task() {
                        &multizone_tof_sensor_task_handle);
 }
 
+bool TaskManager::create_multizone_tof_init_task(void* initializer) {
+    return create_task("MultizoneTOFInit", multizone_tof_init_task, MULTIZONE_TOF_INIT_STACK_SIZE, Priority::SYSTEM_CONTROL, Core::CORE_0,
+                       &multizone_tof_init_task_handle, initializer);
+}
+
 bool TaskManager::create_side_tof_sensor_task() {
     return create_task("SideTOF", side_tof_sensor_task, SIDE_TOF_STACK_SIZE, Priority::SYSTEM_CONTROL, Core::CORE_0, &side_tof_sensor_task_handle);
 }
@@ -434,6 +467,15 @@ bool TaskManager::create_sensor_logger_task() {
     return create_task("SensorLogger", sensor_logger_task, SENSOR_LOGGER_STACK_SIZE, Priority::BACKGROUND, Core::CORE_1, &sensor_logger_task_handle);
 }
 
+bool TaskManager::create_i2c_bus_tasks() {
+    // Above every bus user, so a queued transfer starts as soon as the bus frees up. Mostly blocked waiting for work
+    const bool BUS_1_CREATED = create_task("I2CBus1", i2c_bus_task, I2C_BUS_STACK_SIZE, Priority::CRITICAL, Core::CORE_0, &i2c_bus_1_task_handle,
+                                           reinterpret_cast<void*>(static_cast<uintptr_t>(I2cBusId::BUS_1)));
+    const bool BUS_2_CREATED = create_task("I2CBus2", i2c_bus_task, I2C_BUS_STACK_SIZE, Priority::CRITICAL, Core::CORE_0, &i2c_bus_2_task_handle,
+                                           reinterpret_cast<void*>(static_cast<uintptr_t>(I2cBusId::BUS_2)));
+    return BUS_1_CREATED && BUS_2_CREATED;
+}
+
 bool TaskManager::is_display_initialized() {
     // Return true if either init task is running or display task already exists
     return (display_init_task_handle != nullptr) || (display_task_handle != nullptr);
@@ -499,7 +541,9 @@ void TaskManager::print_stack_usage() {
                               {demo_manager_task_handle, "DemoManager", DEMO_MANAGER_STACK_SIZE},
                               {game_manager_task_handle, "GameManager", GAME_MANAGER_STACK_SIZE},
                               {career_quest_task_handle, "CareerQuest", CAREER_QUEST_STACK_SIZE},
-                              {display_init_task_handle, "DisplayInit", DISPLAY_INIT_STACK_SIZE}};
+                              {display_init_task_handle, "DisplayInit", DISPLAY_INIT_STACK_SIZE},
+                              {i2c_bus_1_task_handle, "I2CBus1", I2C_BUS_STACK_SIZE},
+                              {i2c_bus_2_task_handle, "I2CBus2", I2C_BUS_STACK_SIZE}};
 
     for (const auto& task : TASKS) {
         if (task.handle != nullptr && eTaskGetState(task.handle) != eDeleted) {
@@ -541,9 +585,7 @@ void TaskManager::sensor_web_socket_task(void* parameter) {
     SerialQueueManager::get_instance().queue_message("[WS_SENSOR] Task started");
 
     for (;;) {
-        if (WiFiClass::status() == WL_CONNECTED) {
-            SensorWebSocketManager::get_instance().poll_websocket();
-        }
+        SensorWebSocketManager::get_instance().poll_websocket(); // Tracks WiFi loss/restore itself
         vTaskDelay(pdMS_TO_TICKS(5)); // Fast polling for sensor data
     }
 }
@@ -554,10 +596,8 @@ void TaskManager::command_web_socket_task(void* parameter) {
     SerialQueueManager::get_instance().queue_message("[WS_CMD] Task started");
 
     for (;;) {
-        if (WiFiClass::status() == WL_CONNECTED) {
-            CommandWebSocketManager::get_instance().poll_websocket();
-        }
-        vTaskDelay(pdMS_TO_TICKS(40)); // Slower polling for commands
+        CommandWebSocketManager::get_instance().poll_websocket(); // Tracks WiFi loss/restore itself
+        vTaskDelay(pdMS_TO_TICKS(CommandWebSocketManager::get_poll_interval_ms())); // Slower polling unless multiplexed
     }
 }
 
@@ -572,7 +612,7 @@ void TaskManager::heartbeat_task(void* parameter) {
             String json_string;
             serializeJson(doc, json_string);
 
-            CommandWebSocketManager::get_instance()._wsClient.send(json_string);
+            CommandWebSocketManager::send_message(json_string, WsChannel::CONTROL);
         }
 
         vTaskDelay(pdMS_TO_TICKS(1000));
@@ -2,6 +2,7 @@
 #include <freertos/FreeRTOS.h> // MUST BE BEFORE TASK.h
 #include <freertos/task.h>
 
+#include "actuators/actuator_mailbox.h"
 #include "actuators/buttons.h"
 #include "actuators/dance_manager.h"
 #include "actuators/led/led_animations.h"
@@ -42,10 +43,12 @@ class TaskManager {
     static bool create_side_tof_sensor_task();
     static bool create_color_sensor_task();
     static bool create_sensor_logger_task();
+    static bool create_multizone_tof_init_task(void* initializer); // One-shot: runs the VL53L7CX firmware upload off the boot path
 
     static bool create_sensor_web_socket_task();  // NEW
     static bool create_command_web_socket_task(); // RENAMED from create_web_socket_polling_task
     static bool create_heartbeat_task();
+    static bool create_i2c_bus_tasks(); // One per bus; call once both Wire and Wire1 are up
 
   private:
     static bool log_task_creation(const char* name, bool success);
@@ -62,6 +65,7 @@ class TaskManager {
     static void side_tof_sensor_task(void* parameter);
     static void color_sensor_task(void* parameter);
     static void sensor_logger_task(void* parameter);
+    static void multizone_tof_init_task(void* parameter);
 
     static void display_task(void* parameter);
     static void display_init_task(void* parameter); // NEW: Display init task
@@ -77,6 +81,7 @@ class TaskManager {
     static void sensor_web_socket_task(void* parameter);  // NEW
     static void command_web_socket_task(void* parameter); // RENAMED
     static void heartbeat_task(void* parameter);
+    static void i2c_bus_task(void* parameter);
 
     static constexpr uint32_t BUTTON_STACK_SIZE = 4096;
     static constexpr uint32_t SERIAL_INPUT_STACK_SIZE = 10240;
@@ -86,12 +91,13 @@ class TaskManager {
     static constexpr uint32_t SENSOR_POLLING_STACK_SIZE = 10240; // Just polling (deprecated)
 
     // Individual sensor stack sizes
-    static constexpr uint32_t IMU_SENSOR_STACK_SIZE = 4096;     // Fast, lightweight
-    static constexpr uint32_t ENCODER_SENSOR_STACK_SIZE = 4096; // Fast, lightweight
-    static constexpr uint32_t MULTIZONE_TOF_STACK_SIZE = 8192;  // Heavy processing, 64 zones
-    static constexpr uint32_t SIDE_TOF_STACK_SIZE = 6144;       // Moderate processing
-    static constexpr uint32_t COLOR_SENSOR_STACK_SIZE = 4096;   // Light processing
-    static constexpr uint32_t SENSOR_LOGGER_STACK_SIZE = 4096;  // Light processing - just calling logger functions
+    static constexpr uint32_t IMU_SENSOR_STACK_SIZE = 4096;         // Fast, lightweight
+    static constexpr uint32_t ENCODER_SENSOR_STACK_SIZE = 4096;     // Fast, lightweight
+    static constexpr uint32_t MULTIZONE_TOF_STACK_SIZE = 8192;      // Heavy processing, 64 zones
+    static constexpr uint32_t SIDE_TOF_STACK_SIZE = 6144;           // Moderate processing
+    static constexpr uint32_t COLOR_SENSOR_STACK_SIZE = 4096;       // Light processing
+    static constexpr uint32_t SENSOR_LOGGER_STACK_SIZE = 4096;      // Light processing - just calling logger functions
+    static constexpr uint32_t MULTIZONE_TOF_INIT_STACK_SIZE = 4096; // Firmware comes straight from flash, no large buffers
 
     static constexpr uint32_t DISPLAY_STACK_SIZE = 4096;            // I2C + display buffer operations
     static constexpr uint32_t DISPLAY_INIT_STACK_SIZE = 8192;       // Reduced from 30KB - should be sufficient with optimizations
@@ -107,6 +113,7 @@ class TaskManager {
     static constexpr uint32_t DEMO_MANAGER_STACK_SIZE = 6144;
     static constexpr uint32_t GAME_MANAGER_STACK_SIZE = 8192;
     static constexpr uint32_t CAREER_QUEST_STACK_SIZE = 8192;
+    static constexpr uint32_t I2C_BUS_STACK_SIZE = 3072;
 
     // Task priorities (higher number = higher priority)
     enum class Priority : uint8_t {
@@ -142,6 +149,7 @@ class TaskManager {
     static TaskHandle_t side_tof_sensor_task_handle;
     static TaskHandle_t color_sensor_task_handle;
     static TaskHandle_t sensor_logger_task_handle;
+    static TaskHandle_t multizone_tof_init_task_handle;
 
     static TaskHandle_t display_task_handle;
     static TaskHandle_t display_init_task_handle; // NEW: Display init task handle
@@ -160,4 +168,6 @@ class TaskManager {
     static TaskHandle_t sensor_web_socket_task_handle;  // NEW
     static TaskHandle_t command_web_socket_task_handle; // RENAMED from web_socket_polling_task_handle
     static TaskHandle_t heartbeat_task_handle;
+    static TaskHandle_t i2c_bus_1_task_handle;
+    static TaskHandle_t i2c_bus_2_task_handle;
 };
@@ -1,5 +1,7 @@
 #include "utils.h"
 
+#include <esp_timer.h>
+
 void quaternion_to_euler(float qr, float qi, float qj, float qk, float& yaw, float& pitch, float& roll) {
     // Roll (x-axis rotation)
     float const SINR_COSP = 2 * (qr * qi + qj * qk);
@@ -25,6 +27,10 @@ void quaternion_to_euler(float qr, float qi, float qj, float qk, float& yaw, flo
     roll *= RAD_TO_DEG;
 }
 
+uint64_t IRAM_ATTR micros64() {
+    return static_cast<uint64_t>(esp_timer_get_time());
+}
+
 bool check_address_on_i2c_line(uint8_t addr) {
     byte error = 0;
 
@@ -110,6 +116,8 @@ const char* route_to_string_common(ToCommonMessage route) {
             return "/pip-turning-off";
         case ToCommonMessage::HEARTBEAT:
             return "/heartbeat";
+        case ToCommonMessage::FRAME_ACK:
+            return "/frame-ack";
         default:
             return "";
     }
@@ -152,6 +160,8 @@ const char* route_to_string_serial(ToSerialMessage route) {
             return "/battery-monitor-data-complete";
         case ToSerialMessage::WIFI_DELETED_NETWORK:
             return "/wifi-deleted-network";
+        case ToSerialMessage::SCAN_DIFF:
+            return "/scan-diff";
         default:
             return "";
     }
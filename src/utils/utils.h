@@ -11,6 +11,10 @@ bool check_address_on_i2c_line(uint8_t addr);
 void scan_i2_c();
 float calculate_circular_mean(const float angles[], uint8_t count);
 
+// Microseconds since boot, 64-bit (micros() wraps after ~71 minutes). Every SensorDataBuffer sample is stamped on this
+// clock; safe to call from an ISR
+uint64_t micros64();
+
 const char* route_to_string_common(ToCommonMessage route);
 const char* route_to_string_server(ToServerMessage route);
 const char* route_to_string_serial(ToSerialMessage route);